@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// BarycentricEvaluator::evaluate_columns against evaluating each column
+// with one BFieldElement::inverse() per domain point.
+//
+// Usage: barycentric_bench [log_domain_length [num_columns]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "tip5xx/barycentric.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+template <typename F>
+double milliseconds(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t log_n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+    size_t num_columns = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20;
+
+    const size_t n = size_t{1} << log_n;
+    std::vector<BFieldElement> columns(num_columns * n);
+    for (size_t i = 0; i < columns.size(); i++) {
+        columns[i] = BFieldElement::new_element(i * i + 1);
+    }
+    BarycentricEvaluator evaluator(n, BFieldElement::generator());
+    const BFieldElement point = BFieldElement::new_element(0x1234567890ABCDEFULL);
+
+    std::vector<BFieldElement> batched;
+    double batched_ms = milliseconds([&] { batched = evaluator.evaluate_columns(columns, point); });
+
+    std::vector<BFieldElement> naive(num_columns);
+    double naive_ms = milliseconds([&] {
+        const BFieldElement offset_power = BFieldElement::generator().mod_pow(n);
+        const BFieldElement scale = (point.mod_pow(n) - offset_power) *
+                                    (BFieldElement::new_element(n) * offset_power).inverse();
+        for (size_t c = 0; c < num_columns; c++) {
+            BFieldElement sum = BFieldElement::zero();
+            for (size_t i = 0; i < n; i++) {
+                const BFieldElement& x = evaluator.domain()[i];
+                sum += columns[c * n + i] * x * (point - x).inverse();
+            }
+            naive[c] = sum * scale;
+        }
+    });
+    if (naive != batched) {
+        std::cerr << "results differ" << std::endl;
+        return 1;
+    }
+
+    std::cout << num_columns << " columns on a domain of 2^" << log_n << std::endl
+              << std::fixed << std::setprecision(2)
+              << "  batched:            " << std::setw(10) << batched_ms << " ms" << std::endl
+              << "  inverse per point:  " << std::setw(10) << naive_ms << " ms" << std::endl;
+    return 0;
+}
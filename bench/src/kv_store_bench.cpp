@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// Sustained write throughput of AuthenticatedKvStore: a store is filled
+// with num_keys keys, then batches of random puts to new and existing keys
+// are applied, each batch followed by a commit.
+//
+// Usage: kv_store_bench [num_keys [batch_size [num_batches]]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "tip5xx/authenticated_kv_store.hpp"
+
+using namespace tip5xx;
+
+int main(int argc, char** argv) {
+    size_t num_keys = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    size_t batch_size = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+    size_t num_batches = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 5;
+
+    std::mt19937_64 rng(42);
+    auto random_digest = [&rng]() {
+        Digest digest;
+        for (size_t i = 0; i < Digest::LEN; i++) {
+            digest[i] = BFieldElement::new_element(rng() % BFieldElement::P);
+        }
+        return digest;
+    };
+
+    std::vector<Digest> keys(num_keys);
+    AuthenticatedKvStore store;
+    for (auto& key : keys) {
+        key = random_digest();
+        store.put(key, key);
+    }
+    auto start = std::chrono::steady_clock::now();
+    store.commit();
+    std::chrono::duration<double> fill = std::chrono::steady_clock::now() - start;
+    std::cout << "initial commit of " << num_keys << " keys: " << std::fixed << std::setprecision(2)
+              << fill.count() << " s" << std::endl;
+
+    double total = 0;
+    for (size_t batch = 0; batch < num_batches; batch++) {
+        std::vector<std::pair<Digest, std::optional<Digest>>> updates;
+        for (size_t k = 0; k < batch_size; k++) {
+            const Digest key = k % 2 == 0 ? keys[rng() % keys.size()] : random_digest();
+            updates.emplace_back(key, random_digest());
+        }
+
+        start = std::chrono::steady_clock::now();
+        store.update(updates);
+        store.commit();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        total += elapsed.count();
+        std::cout << "batch " << batch << ": " << std::setprecision(0) << batch_size / elapsed.count()
+                  << " writes/s" << std::endl;
+    }
+    std::cout << "sustained: " << std::setprecision(0) << num_batches * batch_size / total << " writes/s ("
+              << store.size() << " keys)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// LowDegreeExtension::extend against extending the same columns one at a
+// time with an inverse Ntt, a separate coset scaling pass and a forward
+// Ntt.
+//
+// Usage: lde_bench [log_trace_length [expansion_factor [num_columns]]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "tip5xx/low_degree_extension.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+template <typename F>
+double milliseconds(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t log_n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 14;
+    size_t expansion_factor = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 8;
+    size_t num_columns = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 100;
+
+    const size_t n = size_t{1} << log_n;
+    std::vector<BFieldElement> trace(num_columns * n);
+    for (size_t i = 0; i < trace.size(); i++) {
+        trace[i] = BFieldElement::new_element(i * i + 1);
+    }
+
+    LowDegreeExtension lde(n, expansion_factor);
+    Ntt::twiddles(log_n);   // first-use table construction is not timed
+
+    std::vector<BFieldElement> batched;
+    double batched_ms = milliseconds([&] { batched = lde.extend(trace); });
+
+    std::vector<BFieldElement> unfused(num_columns * lde.extension_length());
+    double unfused_ms = milliseconds([&] {
+        for (size_t c = 0; c < num_columns; c++) {
+            std::vector<BFieldElement> column(trace.begin() + c * n, trace.begin() + (c + 1) * n);
+            Ntt::inverse(column);
+            BFieldElement power = BFieldElement::one();
+            for (auto& coefficient : column) {
+                coefficient *= power;
+                power *= BFieldElement::generator();
+            }
+            column.resize(lde.extension_length(), BFieldElement::zero());
+            Ntt::forward(column);
+            std::copy(column.begin(), column.end(), unfused.begin() + c * lde.extension_length());
+        }
+    });
+    if (unfused != batched) {
+        std::cerr << "results differ" << std::endl;
+        return 1;
+    }
+
+    std::cout << num_columns << " columns of 2^" << log_n << " extended " << expansion_factor << "x on "
+              << ThreadPool::shared().num_threads() << " threads" << std::endl
+              << std::fixed << std::setprecision(1)
+              << "  batched: " << std::setw(10) << batched_ms << " ms" << std::endl
+              << "  unfused: " << std::setw(10) << unfused_ms << " ms" << std::endl;
+    return 0;
+}
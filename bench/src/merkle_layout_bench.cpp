@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// Random authentication path extraction from the level-order or the van
+// Emde Boas node layout. Only the chosen layout is built, and paths are
+// written to a reused buffer, so the timing is the node reads alone. Pick
+// a tree larger than the last-level cache; 2^25 leaves take 2.5 GiB.
+//
+// Usage: merkle_layout_bench level|veb [log2_leaves [num_queries]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/veb_merkle_tree.hpp"
+
+using namespace tip5xx;
+
+template <typename Tree>
+void time_paths(const Tree& tree, size_t num_queries) {
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> dist(0, tree.num_leaves() - 1);
+    std::vector<size_t> queries(num_queries);
+    for (auto& q : queries) {
+        q = dist(rng);
+    }
+
+    std::vector<Digest> path(tree.height());
+    uint64_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t leaf_index : queries) {
+        tree.authentication_path(leaf_index, path.data());
+        checksum += path.back()[0].value();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::fixed << std::setprecision(1)
+              << 1e9 * elapsed.count() / num_queries << " ns/path"
+              << " (checksum " << checksum << ")" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    std::string layout = argc > 1 ? argv[1] : "";
+    size_t log_n = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 25;
+    size_t num_queries = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1000000;
+    if (layout != "level" && layout != "veb") {
+        std::cerr << "usage: merkle_layout_bench level|veb [log2_leaves [num_queries]]" << std::endl;
+        return 1;
+    }
+
+    size_t n = size_t{1} << log_n;
+    std::vector<Digest> leaves(n);
+    for (size_t i = 0; i < n; i++) {
+        leaves[i][0] = BFieldElement::new_element(i);
+    }
+
+    std::cout << "building 2^" << log_n << " leaves in " << layout << " order ... " << std::flush;
+    if (layout == "level") {
+        auto tree = MerkleTree::build(leaves);
+        std::vector<Digest>().swap(leaves);
+        time_paths(tree, num_queries);
+    } else {
+        auto tree = VebMerkleTree::build(leaves);
+        std::vector<Digest>().swap(leaves);
+        time_paths(tree, num_queries);
+    }
+    return 0;
+}
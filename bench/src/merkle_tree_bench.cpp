@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// Merkle tree build throughput for 2^20 .. 2^26 leaves.
+//
+// Usage: merkle_tree_bench [min_log2_leaves [max_log2_leaves [num_threads]]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "tip5xx/merkle_tree.hpp"
+
+using namespace tip5xx;
+
+int main(int argc, char** argv) {
+    size_t min_log = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+    size_t max_log = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 26;
+    size_t num_threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 0;
+
+    ThreadPool pool(num_threads);
+    std::cout << "threads: " << pool.num_threads() << std::endl;
+    std::cout << std::setw(10) << "leaves" << std::setw(14) << "seconds"
+              << std::setw(18) << "leaves/s" << std::setw(18) << "hash_pair/s" << std::endl;
+
+    for (size_t log_n = min_log; log_n <= max_log; log_n++) {
+        size_t n = size_t{1} << log_n;
+        std::vector<Digest> leaves(n);
+        for (size_t i = 0; i < n; i++) {
+            leaves[i][0] = BFieldElement::new_element(i);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto tree = MerkleTree::build(leaves, pool);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::setw(7) << "2^" << std::left << std::setw(3) << log_n << std::right
+                  << std::setw(14) << std::fixed << std::setprecision(3) << elapsed.count()
+                  << std::setw(18) << std::setprecision(0) << n / elapsed.count()
+                  << std::setw(18) << (n - 1) / elapsed.count()
+                  << "   root " << tree.root().to_hex().substr(0, 16) << std::endl;
+    }
+
+    return 0;
+}
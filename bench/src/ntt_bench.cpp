@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// Forward and inverse Ntt against a textbook recursive radix-2 NTT, for
+// lengths 2^min_log .. 2^max_log.
+//
+// Usage: ntt_bench [min_log [max_log]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "tip5xx/ntt.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+std::vector<BFieldElement> recursive_ntt(const std::vector<BFieldElement>& coefficients, const BFieldElement& omega) {
+    size_t n = coefficients.size();
+    if (n == 1) {
+        return coefficients;
+    }
+    std::vector<BFieldElement> even(n / 2), odd(n / 2);
+    for (size_t i = 0; i < n / 2; i++) {
+        even[i] = coefficients[2 * i];
+        odd[i] = coefficients[2 * i + 1];
+    }
+    BFieldElement omega_squared = omega * omega;
+    auto even_values = recursive_ntt(even, omega_squared);
+    auto odd_values = recursive_ntt(odd, omega_squared);
+    std::vector<BFieldElement> values(n);
+    BFieldElement x = BFieldElement::one();
+    for (size_t i = 0; i < n / 2; i++) {
+        BFieldElement t = x * odd_values[i];
+        values[i] = even_values[i] + t;
+        values[i + n / 2] = even_values[i] - t;
+        x *= omega;
+    }
+    return values;
+}
+
+template <typename F>
+double milliseconds(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t min_log = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10;
+    size_t max_log = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 22;
+
+    std::cout << std::setw(8) << "log n" << std::setw(14) << "forward ms" << std::setw(14) << "inverse ms"
+              << std::setw(16) << "recursive ms" << std::endl;
+    for (size_t log_n = min_log; log_n <= max_log; log_n++) {
+        size_t n = size_t{1} << log_n;
+        std::vector<BFieldElement> values(n);
+        for (size_t i = 0; i < n; i++) {
+            values[i] = BFieldElement::new_element(i * i + 1);
+        }
+        auto original = values;
+        Ntt::twiddles(log_n - 1);   // first-use table construction is not timed
+
+        double forward_ms = milliseconds([&] { Ntt::forward(values); });
+        double inverse_ms = milliseconds([&] { Ntt::inverse(values); });
+        if (values != original) {
+            std::cerr << "round trip failed at 2^" << log_n << std::endl;
+            return 1;
+        }
+        double recursive_ms = milliseconds([&] {
+            values = recursive_ntt(original, BFieldElement::primitive_root_of_unity(n));
+        });
+
+        std::cout << std::setw(8) << log_n << std::fixed << std::setprecision(2)
+                  << std::setw(14) << forward_ms << std::setw(14) << inverse_ms
+                  << std::setw(16) << recursive_ms << std::endl;
+    }
+    return 0;
+}
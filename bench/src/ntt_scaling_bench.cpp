@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// Thread scaling of the four-step Ntt::forward for one length, on pools of
+// 1, 2, 4, ... max_threads threads, against the flat single-threaded
+// transform.
+//
+// Usage: ntt_scaling_bench [log_n [max_threads]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "tip5xx/ntt.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+template <typename F>
+double milliseconds(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t log_n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 24;
+    size_t max_threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+
+    size_t n = size_t{1} << log_n;
+    std::vector<BFieldElement> original(n);
+    for (size_t i = 0; i < n; i++) {
+        original[i] = BFieldElement::new_element(i * i + 1);
+    }
+    auto values = original;
+    Ntt::twiddles(log_n - 1);   // first-use table construction is not timed
+
+    double flat_ms = milliseconds([&] { Ntt::forward(values); });
+    auto expected = values;
+    std::cout << "2^" << log_n << " on " << std::thread::hardware_concurrency() << " hardware threads" << std::endl
+              << "flat: " << std::fixed << std::setprecision(1) << flat_ms << " ms" << std::endl
+              << std::setw(10) << "threads" << std::setw(14) << "four-step ms"
+              << std::setw(12) << "speedup" << std::endl;
+
+    double single_ms = 0;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        ThreadPool pool(threads);
+        values = original;
+        double ms = milliseconds([&] { Ntt::forward(values, pool); });
+        if (values != expected) {
+            std::cerr << "four-step result differs at " << threads << " threads" << std::endl;
+            return 1;
+        }
+        if (threads == 1) {
+            single_ms = ms;
+        }
+        std::cout << std::setw(10) << threads << std::setw(14) << std::setprecision(1) << ms
+                  << std::setw(11) << std::setprecision(2) << single_ms / ms << "x" << std::endl;
+    }
+    return 0;
+}
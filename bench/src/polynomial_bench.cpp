@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// Polynomial operations against their quadratic algorithms, for n from
+// 2^min_log to 2^max_log: n x n multiplication, 2n / n division, and
+// evaluation and interpolation of degree n - 1 on n points. The crossover
+// points of these columns are the thresholds in polynomial.hpp.
+//
+// Usage: polynomial_bench [min_log [max_log]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "tip5xx/polynomial.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+template <typename F>
+double microseconds(F&& f) {
+    // Repeat short operations for at least 20 ms
+    size_t runs = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::micro> elapsed{};
+    do {
+        f();
+        runs++;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed.count() < 20000);
+    return elapsed.count() / runs;
+}
+
+std::vector<BFieldElement> elements(size_t n, uint64_t seed) {
+    std::vector<BFieldElement> result(n);
+    for (size_t i = 0; i < n; i++) {
+        result[i] = BFieldElement::new_element(seed * 0x9E3779B97F4A7C15ULL + i * i * i + 1);
+    }
+    return result;
+}
+
+std::vector<BFieldElement> multiply_quadratic(const std::vector<BFieldElement>& a, const std::vector<BFieldElement>& b) {
+    std::vector<BFieldElement> product(a.size() + b.size() - 1);
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) {
+            product[i + j] += a[i] * b[j];
+        }
+    }
+    return product;
+}
+
+std::vector<BFieldElement> divide_quadratic(std::vector<BFieldElement> a, const std::vector<BFieldElement>& b) {
+    const BFieldElement lead_inverse = b.back().inverse();
+    for (size_t i = a.size() - b.size() + 1; i-- > 0;) {
+        BFieldElement factor = a[i + b.size() - 1] * lead_inverse;
+        for (size_t j = 0; j < b.size(); j++) {
+            a[i + j] -= factor * b[j];
+        }
+    }
+    a.resize(b.size() - 1);
+    return a;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t min_log = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4;
+    size_t max_log = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 12;
+
+    std::cout << "microseconds per operation, library / quadratic" << std::endl
+              << std::setw(8) << "n" << std::setw(24) << "multiply" << std::setw(24) << "divide"
+              << std::setw(24) << "evaluate" << std::setw(24) << "interpolate" << std::endl;
+    for (size_t log_n = min_log; log_n <= max_log; log_n++) {
+        size_t n = size_t{1} << log_n;
+        Polynomial a(elements(n, 1));
+        Polynomial b(elements(n, 2));
+        Polynomial dividend(elements(2 * n, 3));
+        auto points = elements(n, 4);
+        auto values = a.evaluate(points);
+
+        double multiply = microseconds([&] { a * b; });
+        double multiply_q = microseconds([&] { multiply_quadratic(a.coefficients(), b.coefficients()); });
+        double divide = microseconds([&] { dividend.divide(b); });
+        double divide_q = microseconds([&] { divide_quadratic(dividend.coefficients(), b.coefficients()); });
+        double evaluate = microseconds([&] { a.evaluate(points); });
+        double evaluate_q = microseconds([&] {
+            for (const auto& point : points) {
+                a.evaluate(point);
+            }
+        });
+        double interpolate = microseconds([&] { Polynomial::interpolate(points, values); });
+
+        auto column = [](double library, double quadratic) {
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(1) << library;
+            if (quadratic >= 0) {
+                oss << " / " << quadratic;
+            }
+            return oss.str();
+        };
+        std::cout << std::setw(8) << n << std::setw(24) << column(multiply, multiply_q)
+                  << std::setw(24) << column(divide, divide_q) << std::setw(24) << column(evaluate, evaluate_q)
+                  << std::setw(24) << column(interpolate, -1) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+// Memory against CPU per authentication path for StridedMerkleTree, for
+// level strides 1 (every level stored) to max_stride.
+//
+// Usage: strided_merkle_bench [log2_leaves [max_stride [num_queries]]]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "tip5xx/strided_merkle_tree.hpp"
+
+using namespace tip5xx;
+
+int main(int argc, char** argv) {
+    size_t log_n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+    size_t max_stride = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 8;
+    size_t num_queries = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1000;
+
+    size_t n = size_t{1} << log_n;
+    std::vector<Digest> leaves(n);
+    for (size_t i = 0; i < n; i++) {
+        leaves[i][0] = BFieldElement::new_element(i);
+    }
+
+    std::mt19937_64 rng(42);
+    std::vector<size_t> queries(num_queries);
+    for (auto& q : queries) {
+        q = rng() % n;
+    }
+
+    std::cout << std::setw(8) << "stride" << std::setw(16) << "internal MiB"
+              << std::setw(16) << "us/path" << std::endl;
+    for (size_t stride = 1; stride <= max_stride; stride++) {
+        auto tree = StridedMerkleTree::build(leaves, stride);
+        double internal_mib = double(tree.num_stored_digests() - n) * sizeof(Digest) / (1 << 20);
+
+        uint64_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t leaf_index : queries) {
+            checksum += tree.authentication_path(leaf_index).back()[0].value();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::setw(8) << stride << std::setw(16) << std::fixed << std::setprecision(2) << internal_mib
+                  << std::setw(16) << std::setprecision(1) << 1e6 * elapsed.count() / num_queries
+                  << "   (checksum " << checksum % 1000 << ")" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree_error.hpp"
+
+namespace tip5xx {
+
+// Path from the root of an AuthenticatedKvStore to the leaf reached by
+// following a key's bits
+struct KvProof {
+    // Split bit and sibling digest of every branch, from the root down
+    std::vector<uint32_t> bits;
+    std::vector<Digest> siblings;
+    // (key, value) of the leaf at the end of the path; empty for an empty store
+    std::optional<std::pair<Digest, Digest>> leaf;
+
+    // With value == std::nullopt this proves that the key is absent
+    bool verify(const Digest& root, const Digest& key, const std::optional<Digest>& value) const;
+};
+
+/**
+ * Key/value map committed to by a binary Patricia trie over the 320 bits
+ * of Digest keys (element 0 first, most significant bit first).
+ *
+ * A leaf stores a key and its value and hashes to hash_varlen(key, value).
+ * A branch stores the first bit in which the keys below it differ and
+ * hashes to hash_pair(left, right) with branch_tag(bit) as domain tag,
+ * so the trie shape is part of the commitment at one permutation per
+ * branch; the bit sits in the capacity, out of reach of the digests a
+ * proof supplies. Keys are chosen by callers, so leaves use the
+ * variable-length domain to keep them from posing as branches. The empty store has the zero Digest as root. As the
+ * trie is compressed, a lookup or a proof visits O(log n) nodes for n
+ * random keys instead of a fixed 64 or 320 levels.
+ *
+ * Writes only link nodes and flag the path to the root as dirty; commit()
+ * rehashes the flagged nodes once, however many writes touched them, a
+ * level of branches at a time through Tip5::hash_pair_batch. root() and
+ * prove() describe the latest commit.
+ */
+class AuthenticatedKvStore {
+public:
+    static constexpr uint32_t KEY_BITS = Digest::LEN * 64;
+
+    static Digest leaf_digest(const Digest& key, const Digest& value);
+    static Digest branch_digest(uint32_t bit, const Digest& left, const Digest& right);
+    // Tip5::hash_pair domain tag of a branch splitting on the given bit
+    static BFieldElement branch_tag(uint32_t bit);
+    static bool key_bit(const Digest& key, uint32_t bit);
+
+    std::optional<Digest> get(const Digest& key) const;
+    void put(const Digest& key, const Digest& value);
+    void remove(const Digest& key);
+
+    // Put (value) or remove (std::nullopt) several keys, in order
+    void update(const std::vector<std::pair<Digest, std::optional<Digest>>>& updates);
+
+    // Rehash the nodes changed since the previous commit and return the root
+    Digest commit();
+
+    Digest root() const { return root_digest_; }
+    bool has_uncommitted_changes() const;
+    size_t size() const { return size_; }
+
+    // Throws MerkleTreeError if there are uncommitted changes
+    KvProof prove(const Digest& key) const;
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    // A node with left == NONE is a leaf
+    struct Node {
+        Digest digest;
+        Digest key;
+        Digest value;
+        uint32_t left = NONE;
+        uint32_t right = NONE;
+        uint32_t bit = 0;
+        bool dirty = true;
+
+        bool is_leaf() const { return left == NONE; }
+    };
+
+    uint32_t new_node(Node node);
+    void free_node(uint32_t index);
+
+    // Index of the leaf reached from the root by following the key's bits
+    uint32_t find_leaf(const Digest& key) const;
+
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> free_;
+    uint32_t root_ = NONE;
+    size_t size_ = 0;
+    Digest root_digest_;
+    // A put or remove changed the store since the last commit. Not derivable
+    // from the root's dirty flag: a remove can collapse the root onto a
+    // clean subtree.
+    bool changed_ = false;
+};
+
+} // namespace tip5xx
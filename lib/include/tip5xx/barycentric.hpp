@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/ntt_error.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+/**
+ * Barycentric evaluation of interpolants on a power-of-two coset.
+ *
+ * For the domain x_i = offset * omega^i of length n, the polynomial of
+ * degree below n with values v_i on it evaluates at z outside the domain
+ * to
+ *
+ *     f(z) = (z^n - offset^n) / (n * offset^n) * sum_i v_i * x_i / (z - x_i)
+ *
+ * All n denominators z - x_i are inverted with one batch inversion per
+ * point, shared by every column evaluated at that point. The weighted sums
+ * accumulate unreduced 128-bit products and reduce once per column.
+ */
+class BarycentricEvaluator {
+public:
+    // Throws NttError unless domain_length is a valid Ntt length
+    explicit BarycentricEvaluator(size_t domain_length,
+                                  const BFieldElement& domain_offset = BFieldElement::one());
+
+    size_t domain_length() const { return domain_.size(); }
+    const std::vector<BFieldElement>& domain() const { return domain_; }
+
+    // Throws NttError unless values has domain_length() elements
+    BFieldElement evaluate(const std::vector<BFieldElement>& values, const BFieldElement& point) const;
+
+    // Every column of the column-major matrix at the same point. Throws
+    // NttError unless columns holds a whole number of columns.
+    std::vector<BFieldElement> evaluate_columns(const std::vector<BFieldElement>& columns,
+                                                const BFieldElement& point) const;
+    std::vector<BFieldElement> evaluate_columns(const std::vector<BFieldElement>& columns,
+                                                const BFieldElement& point, ThreadPool& pool) const;
+
+private:
+    std::vector<BFieldElement> domain_;
+    BFieldElement offset_power_;   // offset^n
+    BFieldElement normalizer_;     // 1 / (n * offset^n)
+
+    std::vector<BFieldElement> evaluate_columns(const std::vector<BFieldElement>& columns,
+                                                const BFieldElement& point, ThreadPool* pool) const;
+};
+
+} // namespace tip5xx
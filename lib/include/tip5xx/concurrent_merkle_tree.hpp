@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+
+namespace tip5xx {
+
+// Root of a ConcurrentMerkleTree as of one commit; epoch 0 is the tree the
+// object was constructed with
+struct MerkleRootSnapshot {
+    uint64_t epoch = 0;
+    Digest root;
+};
+
+/**
+ * Merkle tree whose leaves can be written by many threads at once.
+ *
+ * set_leaf() never takes a lock: the leaf is written under its own
+ * sequence counter and the writer then flags the leaf and its ancestors
+ * as dirty, stopping at the first ancestor that is already flagged. The
+ * tree is rehashed by commit(), which collects the flagged nodes top-down,
+ * clearing the flags as it goes, and hashes them bottom-up one level at a
+ * time with Tip5::hash_pair_batch, so an ancestor shared by many writes
+ * is hashed once per epoch. A write that races with a commit is either
+ * picked up by it or left flagged for the next one.
+ *
+ * snapshot() returns the root published by the latest commit without
+ * waiting for writers or for a running commit. commit() calls and the
+ * queries on committed nodes are serialized among themselves.
+ */
+class ConcurrentMerkleTree {
+public:
+    // The number of leaves must be a non-zero power of two
+    explicit ConcurrentMerkleTree(const std::vector<Digest>& leaves);
+
+    ConcurrentMerkleTree(const ConcurrentMerkleTree&) = delete;
+    ConcurrentMerkleTree& operator=(const ConcurrentMerkleTree&) = delete;
+
+    size_t num_leaves() const { return num_leaves_; }
+    size_t height() const;
+
+    // Safe to call from any number of threads
+    void set_leaf(size_t leaf_index, const Digest& leaf);
+    Digest leaf(size_t leaf_index) const;
+
+    // Rehash the nodes dirtied since the previous commit and publish the
+    // new root as the next epoch
+    MerkleRootSnapshot commit();
+    MerkleRootSnapshot snapshot() const;
+
+    // Authentication path in the tree of the latest commit
+    std::vector<Digest> authentication_path(size_t leaf_index) const;
+
+private:
+    // Digest guarded by a sequence counter that is odd while a write is in
+    // progress; readers retry until they see the same even value before
+    // and after copying
+    struct VersionedDigest {
+        std::atomic<uint64_t> sequence{0};
+        std::array<std::atomic<uint64_t>, Digest::LEN> words;
+
+        void store(const Digest& digest);
+        Digest load(uint64_t* sequence_out = nullptr) const;
+    };
+
+    void check_leaf_index(size_t leaf_index) const;
+
+    size_t num_leaves_;
+
+    // Live leaves, written by set_leaf()
+    std::vector<VersionedDigest> leaves_;
+
+    // dirty_[i] is set when node i (level-order index, as in MerkleTree)
+    // has changed since the latest commit
+    std::vector<std::atomic<bool>> dirty_;
+
+    // The tree of the latest commit; only touched under commit_mutex_
+    mutable std::mutex commit_mutex_;
+    std::vector<Digest> committed_;
+
+    // Root of the latest commit; its sequence counter is twice the epoch
+    VersionedDigest published_root_;
+};
+
+} // namespace tip5xx
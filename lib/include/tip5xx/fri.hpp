@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/digest.hpp"
+#include "tip5xx/fri_error.hpp"
+#include "tip5xx/merkle_multi_proof.hpp"
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+struct FriParameters {
+    // The evaluation domain is the coset domain_offset * <omega> of size
+    // domain_length, omega a primitive domain_length-th root of unity
+    BFieldElement domain_offset = BFieldElement::generator();
+    size_t domain_length = 0;
+    // Ratio of domain length to number of polynomial coefficients
+    size_t expansion_factor = 0;
+    size_t num_queries = 0;
+
+    // Codewords of polynomials of at most this degree are accepted
+    size_t max_degree() const { return domain_length / expansion_factor - 1; }
+    size_t num_rounds() const;
+};
+
+// One committed codeword f of length n. Leaf i of its Merkle tree holds
+// the pair (f[i], f[i + n/2]) that folding combines, so a query opens one
+// leaf per round.
+struct FriRoundProof {
+    Digest root;
+    // The pairs of the queried leaves, in query order
+    std::vector<std::array<BFieldElement, 2>> revealed;
+    MerkleMultiProof opening;
+};
+
+struct FriProof {
+    std::vector<FriRoundProof> rounds;
+    // The codeword after the last folding; expansion_factor equal values
+    std::vector<BFieldElement> last_codeword;
+};
+
+/**
+ * FRI low-degree test over BFieldElement codewords.
+ *
+ * The prover commits to the codeword, and folds it in half with a
+ * challenge drawn from the Tip5 sponge transcript after every
+ * commitment, until expansion_factor values are left; for a codeword of
+ * degree at most max_degree() these are all equal. Query indices are
+ * then sampled from the sponge, and every round opens the leaves on the
+ * queries' folding paths, which the verifier checks for consistency.
+ *
+ * Folding and leaf hashing are split over a ThreadPool, leaves are hashed
+ * with Tip5::hash_pair_batch and the trees are built with the parallel
+ * MerkleTree::build; the rounds' openings are assembled in parallel.
+ */
+class Fri {
+public:
+    explicit Fri(const FriParameters& parameters);
+
+    const FriParameters& parameters() const { return parameters_; }
+
+    FriProof prove(const std::vector<BFieldElement>& codeword) const;
+    FriProof prove(const std::vector<BFieldElement>& codeword, ThreadPool& pool) const;
+    bool verify(const FriProof& proof) const;
+
+    // hash_10 of (first, second, 0, ..., 0)
+    static Digest leaf_digest(const BFieldElement& first, const BFieldElement& second);
+
+    // Merkle tree over the leaves (codeword[i], codeword[i + n/2])
+    static MerkleTree commit(const std::vector<BFieldElement>& codeword, ThreadPool& pool);
+
+    // Codeword on the domain offset^2 * <omega^2> of
+    // (f_even + challenge * f_odd), where f(x) = f_even(x^2) + x f_odd(x^2)
+    // has the given codeword on offset * <omega>
+    static std::vector<BFieldElement> fold(
+        const std::vector<BFieldElement>& codeword,
+        const BFieldElement& offset,
+        const BFieldElement& challenge,
+        ThreadPool& pool);
+
+private:
+    FriParameters parameters_;
+};
+
+} // namespace tip5xx
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/digest.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+/**
+ * Memoizing front end for Tip5::hash_pair and Tip5::hash_10, for workloads
+ * that hash the same inputs over and over (default subtrees of sparse
+ * trees, zero padding).
+ *
+ * hash_pair(left, right) equals hash_10(left || right), so both share one
+ * table keyed by the 10 input elements. The table is split into shards,
+ * each behind its own mutex, and each shard into 2-way sets; a miss
+ * evicts the less recently used entry of its set. The memory budget fixes
+ * the number of entries up front; nothing is allocated afterwards.
+ * Lookups take a shard lock only while probing or filling the table, never
+ * while hashing.
+ */
+class HashCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        double hit_rate() const {
+            return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+    };
+
+    static constexpr size_t WAYS = 2;
+    static constexpr size_t DEFAULT_NUM_SHARDS = 16;
+
+    // Uses at most about memory_budget bytes, with room for at least one
+    // set per shard
+    explicit HashCache(size_t memory_budget, size_t num_shards = DEFAULT_NUM_SHARDS);
+
+    Digest hash_pair(const Digest& left, const Digest& right);
+    std::array<BFieldElement, Digest::LEN> hash_10(const std::array<BFieldElement, RATE>& input);
+
+    // Tip5::hash_pair_batch for the misses only
+    void hash_pair_batch(const Digest* left, const Digest* right, Digest* out, size_t count);
+
+    size_t capacity() const { return shards_.size() * sets_per_shard_ * WAYS; }
+    Stats stats() const;
+    void reset_stats();
+    void clear();
+
+private:
+    using Key = std::array<uint64_t, RATE>;
+
+    struct Entry {
+        Key key;
+        Digest value;
+        bool valid = false;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+        // Per set, the way that was used last
+        std::vector<uint8_t> recent;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    static Key make_key(const Digest& left, const Digest& right);
+    static uint64_t key_hash(const Key& key);
+
+    bool lookup(const Key& key, Digest& value);
+    void insert(const Key& key, const Digest& value);
+
+    size_t sets_per_shard_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace tip5xx
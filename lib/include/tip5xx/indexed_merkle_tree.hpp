@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+
+namespace tip5xx {
+
+// Entry of the sorted linked list stored in the leaves of an
+// IndexedMerkleTree. next_value == 0 marks the entry with the largest value.
+struct IndexedMerkleLeaf {
+    uint64_t value = 0;
+    uint64_t next_value = 0;
+    uint64_t next_index = 0;
+
+    // hash_varlen of the three fields as BFieldElements
+    Digest digest() const;
+
+    bool operator==(const IndexedMerkleLeaf& other) const {
+        return value == other.value && next_value == other.next_value && next_index == other.next_index;
+    }
+};
+
+// Inclusion proof of one leaf. It proves membership of leaf.value, and
+// non-membership of every value strictly between leaf.value and
+// leaf.next_value (or above leaf.value, if it is the largest).
+struct IndexedMerkleProof {
+    size_t leaf_index = 0;
+    IndexedMerkleLeaf leaf;
+    std::vector<Digest> authentication_path;
+
+    // tree_height is that of the tree the root commits to, log2(capacity);
+    // a path of any other length is rejected
+    bool verify_membership(const Digest& root, size_t tree_height, uint64_t value) const;
+    bool verify_non_membership(const Digest& root, size_t tree_height, uint64_t value) const;
+
+private:
+    bool verify_inclusion(const Digest& root, size_t tree_height) const;
+};
+
+/**
+ * Set of field values committed to by a Merkle tree of fixed capacity
+ * whose leaves form a linked list sorted by value.
+ *
+ * Leaf 0 holds the value 0, which is reserved, and every inserted value
+ * takes the next free leaf. Unused leaves are the zero Digest. Proving
+ * that a value v is absent takes a single inclusion proof of depth
+ * log2(capacity), for the "low leaf" whose value is the largest below v
+ * and whose successor is above v. An insertion changes the new leaf and
+ * its low leaf; a batch of insertions rehashes all changed paths together
+ * with MerkleTree::update.
+ */
+class IndexedMerkleTree {
+public:
+    // capacity must be a power of two of at least 2
+    explicit IndexedMerkleTree(size_t capacity);
+
+    size_t capacity() const { return tree_.num_leaves(); }
+    // Number of inserted values, not counting the reserved 0
+    size_t size() const { return leaves_.size() - 1; }
+    Digest root() const { return tree_.root(); }
+    size_t height() const { return tree_.height(); }
+
+    const IndexedMerkleLeaf& leaf(size_t leaf_index) const;
+    bool contains(uint64_t value) const { return index_of_.count(value) != 0; }
+
+    // Values must be canonical field elements other than 0 and not yet in
+    // the set; a batch is checked as a whole before anything is inserted.
+    // Return the leaf indices of the new values.
+    size_t insert(uint64_t value);
+    std::vector<size_t> insert(const std::vector<uint64_t>& values);
+
+    // Proof for the value's own leaf if it is in the set, else for its low leaf
+    IndexedMerkleProof prove(uint64_t value) const;
+
+private:
+    size_t low_leaf_index(uint64_t value) const;
+
+    MerkleTree tree_;
+    std::vector<IndexedMerkleLeaf> leaves_;
+    std::map<uint64_t, size_t> index_of_;
+};
+
+} // namespace tip5xx
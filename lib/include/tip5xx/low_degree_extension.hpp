@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/ntt.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+/**
+ * Batched low-degree extension of columns over cosets.
+ *
+ * A column holds the values of a polynomial f of degree below n on the
+ * trace domain trace_offset * <omega_n>; its extension is f on the
+ * extension domain extension_offset * <omega_nb>, for b the expansion
+ * factor. Matrices are column-major: column c occupies
+ * [c * length, (c + 1) * length).
+ *
+ * Each column costs one NTT of length n and one of length nb. The inverse
+ * transform's reversal and 1/n scaling and both coset shifts are folded
+ * into a single pass with weights (extension_offset / trace_offset)^i / n
+ * computed once per LowDegreeExtension. The twiddles are Ntt's, shared by
+ * every column, and columns are spread over the ThreadPool; with fewer
+ * columns than threads each column uses the multi-threaded Ntt instead.
+ */
+class LowDegreeExtension {
+public:
+    // Throws NttError unless n and nb are valid Ntt lengths
+    LowDegreeExtension(size_t trace_length, size_t expansion_factor,
+                       const BFieldElement& extension_offset = BFieldElement::generator(),
+                       const BFieldElement& trace_offset = BFieldElement::one());
+
+    size_t trace_length() const { return weights_.size(); }
+    size_t extension_length() const { return trace_length() * expansion_factor_; }
+
+    // Throws NttError unless columns holds a whole number of trace columns
+    std::vector<BFieldElement> extend(const std::vector<BFieldElement>& columns) const;
+    std::vector<BFieldElement> extend(const std::vector<BFieldElement>& columns, ThreadPool& pool) const;
+
+    // One column of trace_length() values into extension_length() values
+    void extend_column(const BFieldElement* trace_values, BFieldElement* extension_values) const;
+
+private:
+    size_t expansion_factor_;
+    std::vector<BFieldElement> weights_;
+
+    // extension_values holds the trace values in its first trace_length()
+    // elements; pool is null for the single-threaded transforms
+    void extend_in_place(BFieldElement* extension_values, ThreadPool* pool) const;
+};
+
+} // namespace tip5xx
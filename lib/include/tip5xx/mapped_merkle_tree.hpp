@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/mapped_file.hpp"
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+/**
+ * Merkle tree stored in a file and accessed through a memory mapping, for
+ * trees that do not fit in RAM.
+ *
+ * File layout, all integers little-endian:
+ *   [0, 8)     magic "TIP5MKT\0"
+ *   [8, 16)    format version (1)
+ *   [16, 24)   number of leaves n, a power of two
+ *   [24, 64)   reserved, zero
+ *   [64, ...)  levels 0 (leaves) to log2(n) (root); level l holds n >> l
+ *              digests of Digest::BYTES bytes each, as Digest::to_bytes
+ *
+ * Level l therefore starts at HEADER_SIZE + Digest::BYTES * (2n - 2(n >> l)).
+ */
+class MappedMerkleTree {
+public:
+    static constexpr size_t HEADER_SIZE = 64;
+    static constexpr uint64_t VERSION = 1;
+
+    // Subtrees with 2^STREAM_TILE_HEIGHT leaves are built in memory, one at
+    // a time, which bounds the resident memory of build() to a few MiB
+    static constexpr size_t STREAM_TILE_HEIGHT = 16;
+
+    // Build a tree file from a file of raw leaves (Digest::to_bytes, back to back)
+    static void build(const std::string& leaves_path, const std::string& tree_path);
+    static void build(const std::string& leaves_path, const std::string& tree_path, ThreadPool& pool,
+                      size_t tile_height = STREAM_TILE_HEIGHT);
+
+    // Build a tree file over the leaves [first_leaf, first_leaf + num_leaves)
+    // of a leaves file, e.g. one shard of a larger tree
+    static void build(const std::string& leaves_path, uint64_t first_leaf, uint64_t num_leaves,
+                      const std::string& tree_path, ThreadPool& pool, size_t tile_height = STREAM_TILE_HEIGHT);
+
+    // Map an existing tree file read-only
+    static MappedMerkleTree open(const std::string& tree_path);
+
+    static uint64_t file_size(uint64_t num_leaves);
+    static uint64_t level_offset(uint64_t num_leaves, size_t level);
+
+    uint64_t num_leaves() const { return num_leaves_; }
+    size_t height() const { return height_; }
+
+    Digest root() const { return node(height_, 0); }
+    Digest leaf(uint64_t leaf_index) const;
+
+    // Digest number `index` of level `level` (0 is the leaf level)
+    Digest node(size_t level, uint64_t index) const;
+
+    // Reads one digest per level; the rest of the file is never touched
+    std::vector<Digest> authentication_path(uint64_t leaf_index) const;
+
+private:
+    MappedMerkleTree(MappedFile file, uint64_t num_leaves, size_t height)
+        : file_(std::move(file)), num_leaves_(num_leaves), height_(height) {}
+
+    MappedFile file_;
+    uint64_t num_leaves_;
+    size_t height_;
+};
+
+} // namespace tip5xx
@@ -23,10 +23,40 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace tip5xx {
 
+// Number of independent states processed together by the batched permutation
+constexpr size_t NUM_LANES = 8;
+
+// Wrapping u64 arithmetic on several independent values at once. The
+// lane-wise loops are meant to be mapped onto vector registers.
+template <size_t LANES>
+struct U64Lanes {
+    std::array<uint64_t, LANES> v;
+
+    friend U64Lanes operator+(const U64Lanes& a, const U64Lanes& b) {
+        U64Lanes r;
+        for (size_t i = 0; i < LANES; i++) r.v[i] = a.v[i] + b.v[i];
+        return r;
+    }
+
+    friend U64Lanes operator-(const U64Lanes& a, const U64Lanes& b) {
+        U64Lanes r;
+        for (size_t i = 0; i < LANES; i++) r.v[i] = a.v[i] - b.v[i];
+        return r;
+    }
+
+    friend U64Lanes operator*(const U64Lanes& a, uint64_t c) {
+        U64Lanes r;
+        for (size_t i = 0; i < LANES; i++) r.v[i] = a.v[i] * c;
+        return r;
+    }
+};
+
 std::array<uint64_t, 16> generated_function(const std::array<uint64_t, 16>& input);
+std::array<U64Lanes<NUM_LANES>, 16> generated_function(const std::array<U64Lanes<NUM_LANES>, 16>& input);
 
 } // namespace tip5xx
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "tip5xx/digest.hpp"
+
+namespace tip5xx {
+
+// One claimed Merkle inclusion, as checked by MerkleTree::verify_authentication_path
+struct MerkleInclusionClaim {
+    Digest root;
+    size_t tree_height = 0;
+    size_t leaf_index = 0;
+    Digest leaf;
+    std::vector<Digest> authentication_path;
+};
+
+/**
+ * Verifier for many unrelated Merkle authentication paths.
+ *
+ * All claims are advanced one level at a time, and the hash_pair calls of
+ * one level are evaluated with Tip5::hash_pair_batch. Left/right order is
+ * picked per claim from the bits of its leaf index.
+ */
+class MerkleBatchVerifier {
+public:
+    // Bit i is set iff claims[i] verifies; a failing claim does not stop the others
+    static std::vector<bool> verify(const std::vector<MerkleInclusionClaim>& claims);
+};
+
+} // namespace tip5xx
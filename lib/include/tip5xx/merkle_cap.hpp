@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+
+namespace tip5xx {
+
+/**
+ * Commitment to all 2^cap_height nodes at depth cap_height of a Merkle
+ * tree instead of to its root alone.
+ *
+ * Authentication paths against a cap stop below it, so each one is
+ * cap_height digests shorter and verifying it takes cap_height fewer
+ * hash_pair calls. A cap of height 0 is the root itself. Serialized as
+ * the tree height (8 bytes, little-endian) followed by the cap digests
+ * as Digest::to_bytes, left to right.
+ */
+class MerkleCap {
+public:
+    // digests.size() must be a power of two no larger than 2^tree_height;
+    // throws MerkleTreeError::InvalidArgument otherwise
+    MerkleCap(size_t tree_height, std::vector<Digest> digests);
+
+    // Both throw MerkleTreeError::InvalidArgument if cap_height > tree.height()
+    static MerkleCap from_tree(const MerkleTree& tree, size_t cap_height);
+
+    // The first tree.height() - cap_height siblings of the leaf's path
+    static std::vector<Digest> authentication_path(const MerkleTree& tree, size_t cap_height, size_t leaf_index);
+
+    size_t tree_height() const { return tree_height_; }
+    size_t cap_height() const;
+    const std::vector<Digest>& digests() const { return digests_; }
+
+    // The root of the tree, hashed up from the cap
+    Digest root() const;
+
+    bool verify(size_t leaf_index, const Digest& leaf, const std::vector<Digest>& authentication_path) const;
+
+    std::vector<uint8_t> to_bytes() const;
+    static std::optional<MerkleCap> from_bytes(const std::vector<uint8_t>& bytes);
+
+private:
+    size_t tree_height_;
+    std::vector<Digest> digests_;
+};
+
+} // namespace tip5xx
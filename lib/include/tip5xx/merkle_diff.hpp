@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+
+namespace tip5xx {
+
+// Half-open range [begin, end) of leaf indices
+struct LeafRange {
+    size_t begin = 0;
+    size_t end = 0;
+
+    bool operator==(const LeafRange& other) const { return begin == other.begin && end == other.end; }
+};
+
+class MerkleDiff {
+public:
+    // Leaf ranges on which two trees with the same number of leaves differ.
+    // Subtrees whose roots are equal are skipped, so k differing leaves
+    // cost O(k log n) digest comparisons.
+    static std::vector<LeafRange> diff(const MerkleTree& a, const MerkleTree& b);
+
+    // Maximal ranges of consecutive indices of a sorted list of leaf indices
+    static std::vector<LeafRange> to_ranges(const std::vector<size_t>& leaf_indices);
+};
+
+// Asks the remote replica for its digests of the given level-order node
+// indices. Serialized as little-endian u64s: num_leaves, the number of
+// indices, the indices.
+struct MerkleSyncRequest {
+    uint64_t num_leaves = 0;
+    std::vector<uint64_t> node_indices;
+
+    std::vector<uint8_t> to_bytes() const;
+    static std::optional<MerkleSyncRequest> from_bytes(const std::vector<uint8_t>& bytes);
+};
+
+// The digests asked for, in request order. Serialized as a little-endian
+// u64 count followed by the digests as Digest::to_bytes.
+struct MerkleSyncResponse {
+    std::vector<Digest> digests;
+
+    std::vector<uint8_t> to_bytes() const;
+    static std::optional<MerkleSyncResponse> from_bytes(const std::vector<uint8_t>& bytes);
+};
+
+/**
+ * Anti-entropy between two replicas of a Merkle tree of the same size.
+ *
+ * The local side walks the remote tree top-down, one level per round
+ * trip: it asks for the root, and for both children of every node whose
+ * remote digest differs from its own. The remote side answers each
+ * request with respond(). With k differing leaves this exchanges
+ * O(k log n) digests in height() + 1 round trips, after which
+ * differing_leaves() holds the remote digests of exactly the leaves that
+ * differ, ready for MerkleTree::update.
+ *
+ * The local tree must outlive the session and not change during it.
+ */
+class MerkleSync {
+public:
+    explicit MerkleSync(const MerkleTree& local);
+
+    // Answer a request from the remote side
+    static MerkleSyncResponse respond(const MerkleTree& tree, const MerkleSyncRequest& request);
+
+    bool done() const { return request_.node_indices.empty(); }
+    const MerkleSyncRequest& request() const { return request_; }
+
+    // Compare the response with the local tree and prepare the next request
+    void receive(const MerkleSyncResponse& response);
+
+    // (leaf index, remote leaf) for every differing leaf, ascending
+    const std::vector<std::pair<size_t, Digest>>& differing_leaves() const { return differing_leaves_; }
+    std::vector<LeafRange> differing_leaf_ranges() const;
+
+private:
+    const MerkleTree& local_;
+    MerkleSyncRequest request_;
+    std::vector<std::pair<size_t, Digest>> differing_leaves_;
+};
+
+} // namespace tip5xx
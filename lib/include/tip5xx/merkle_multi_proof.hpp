@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+
+namespace tip5xx {
+
+/**
+ * Opening of several leaves of the same Merkle tree.
+ *
+ * Instead of one authentication path per leaf, the proof carries the
+ * authentication structure: the minimal set of sibling digests needed to
+ * recompute the root from all opened leaves. Ancestors shared by several
+ * leaves are recomputed once during verification.
+ *
+ * The authentication structure is ordered level by level from the leaves
+ * up, and by ascending node index within a level. A sibling is left out
+ * when it is itself an opened leaf or the ancestor of one, since the
+ * verifier computes it anyway; the verifier consumes the digests in the
+ * same order and rejects leftovers.
+ */
+struct MerkleMultiProof {
+    size_t tree_height = 0;
+    std::vector<std::pair<size_t, Digest>> indexed_leaves;
+    std::vector<Digest> authentication_structure;
+
+    // Open the given leaves of the tree; duplicate indices are allowed
+    static MerkleMultiProof generate(const MerkleTree& tree, const std::vector<size_t>& leaf_indices);
+
+    // Node indices (see MerkleTree) whose digests form the authentication
+    // structure for the given leaves, in proof order
+    static std::vector<size_t> authentication_structure_node_indices(
+        size_t num_leaves,
+        const std::vector<size_t>& leaf_indices);
+
+    bool verify(const Digest& root) const;
+};
+
+} // namespace tip5xx
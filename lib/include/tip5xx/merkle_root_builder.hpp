@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+
+namespace tip5xx {
+
+/**
+ * Merkle root of a stream of leaves, computed without buffering them.
+ *
+ * The builder keeps one pending subtree root per set bit of the number of
+ * leaves pushed so far, so at most log2(n) + 1 digests. Pushing a leaf
+ * merges equal-height subtrees with Tip5::hash_pair like a binary counter
+ * carries. The leaf-count rule is MerkleTree's: there is no padding, and
+ * root() requires a non-zero power of two, in which case it equals
+ * MerkleTree::build(leaves).root().
+ */
+class MerkleRootBuilder {
+public:
+    void push(const Digest& leaf);
+    void push(const Digest* leaves, size_t count);
+
+    uint64_t num_leaves() const { return num_leaves_; }
+    size_t num_pending() const { return pending_.size(); }
+
+    // Throws MerkleTreeError if num_leaves() is not a non-zero power of two
+    Digest root() const;
+
+private:
+    uint64_t num_leaves_ = 0;
+    // Roots of complete subtrees, largest first
+    std::vector<Digest> pending_;
+};
+
+} // namespace tip5xx
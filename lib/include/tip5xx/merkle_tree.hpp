@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree_error.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+/**
+ * Binary Merkle tree over Digest leaves, hashed with Tip5::hash_pair.
+ *
+ * All nodes live in one contiguous array in level order: the root has
+ * node index 1, the children of node i are 2i and 2i + 1, and the leaves
+ * occupy indices [num_leaves, 2 * num_leaves). Index 0 is unused.
+ */
+class MerkleTree {
+public:
+    static constexpr size_t ROOT_INDEX = 1;
+
+    // Height of the subtree tiles that are built depth-first by a single
+    // thread; 2^10 leaves keep a tile's 80 KiB of nodes inside L2
+    static constexpr size_t TILE_HEIGHT = 10;
+
+    // Build the tree; the number of leaves must be a non-zero power of two
+    static MerkleTree build(const std::vector<Digest>& leaves);
+    static MerkleTree build(const std::vector<Digest>& leaves, ThreadPool& pool);
+    static MerkleTree build(const Digest* leaves, size_t num_leaves, ThreadPool& pool);
+
+    Digest root() const { return nodes_[ROOT_INDEX]; }
+    size_t num_leaves() const { return nodes_.size() / 2; }
+    size_t height() const;
+
+    const Digest& leaf(size_t leaf_index) const;
+    const Digest& node(size_t node_index) const { return nodes_[node_index]; }
+    const std::vector<Digest>& nodes() const { return nodes_; }
+
+    // Replace the given leaves and rehash only their ancestors, one level at
+    // a time with Tip5::hash_pair_batch. The cost is proportional to the
+    // number of distinct dirty nodes, not to the size of the tree. If an
+    // index occurs more than once, the last update wins. Throws, leaving
+    // the tree untouched, if any index is out of bounds.
+    void update(const std::vector<std::pair<size_t, Digest>>& leaf_updates);
+
+    // Sibling digests from the leaf level up to, excluding, the root
+    std::vector<Digest> authentication_path(size_t leaf_index) const;
+    // Write the height() digests of the path to `path` without allocating
+    void authentication_path(size_t leaf_index, Digest* path) const;
+
+    static bool verify_authentication_path(
+        const Digest& root,
+        size_t tree_height,
+        size_t leaf_index,
+        const Digest& leaf,
+        const std::vector<Digest>& authentication_path);
+
+    static bool is_valid_num_leaves(size_t num_leaves) {
+        return num_leaves != 0 && (num_leaves & (num_leaves - 1)) == 0;
+    }
+
+private:
+    explicit MerkleTree(std::vector<Digest> nodes) : nodes_(std::move(nodes)) {}
+
+    std::vector<Digest> nodes_;
+};
+
+} // namespace tip5xx
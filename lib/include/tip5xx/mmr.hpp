@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "tip5xx/digest.hpp"
+
+namespace tip5xx {
+
+/**
+ * Merkle Mountain Range (MMR): an append-only list of leaves committed to
+ * by a list of perfect Merkle trees ("mountains") whose sizes follow the
+ * binary representation of the number of leaves. The peaks, i.e. the
+ * mountain roots, are stored highest mountain first.
+ */
+
+// Authentication path of a leaf inside its mountain
+struct MmrMembershipProof {
+    uint64_t leaf_index = 0;
+    std::vector<Digest> authentication_path;
+
+    bool verify(const Digest& leaf, const std::vector<Digest>& peaks, uint64_t num_leaves) const;
+
+    // Keep the proof valid after new_leaf was appended to an MMR that had
+    // old_num_leaves leaves and old_peaks; the leaf's mountain may have merged
+    void update_from_append(uint64_t old_num_leaves, const Digest& new_leaf, const std::vector<Digest>& old_peaks);
+};
+
+// Peaks-only MMR; enough to append and to verify proofs
+class MmrAccumulator {
+public:
+    MmrAccumulator() = default;
+    MmrAccumulator(uint64_t num_leaves, std::vector<Digest> peaks);
+
+    // Amortized O(1) hash_pair calls, O(log n) worst case
+    void append(const Digest& leaf);
+
+    uint64_t num_leaves() const { return num_leaves_; }
+    const std::vector<Digest>& peaks() const { return peaks_; }
+
+    // Single-digest commitment: hash_varlen(num_leaves || peaks)
+    Digest bag_peaks() const;
+
+    bool verify(const Digest& leaf, const MmrMembershipProof& proof) const {
+        return proof.verify(leaf, peaks_, num_leaves_);
+    }
+
+    // Persistence: 8-byte little-endian leaf count followed by the peaks
+    std::vector<uint8_t> to_bytes() const;
+    static std::optional<MmrAccumulator> from_bytes(const std::vector<uint8_t>& bytes);
+
+private:
+    uint64_t num_leaves_ = 0;
+    std::vector<Digest> peaks_;
+};
+
+// MMR keeping every node, so that it can produce membership proofs
+class ArchivalMmr {
+public:
+    // Returns the index of the new leaf
+    uint64_t append(const Digest& leaf);
+
+    uint64_t num_leaves() const { return levels_.empty() ? 0 : levels_[0].size(); }
+    const Digest& leaf(uint64_t leaf_index) const;
+    std::vector<Digest> peaks() const;
+    Digest bag_peaks() const { return accumulator().bag_peaks(); }
+    MmrAccumulator accumulator() const { return MmrAccumulator(num_leaves(), peaks()); }
+
+    MmrMembershipProof prove(uint64_t leaf_index) const;
+
+private:
+    // levels_[h][j] is the root of the complete subtree of height h over
+    // leaves [j * 2^h, (j + 1) * 2^h)
+    std::vector<std::vector<Digest>> levels_;
+};
+
+} // namespace tip5xx
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/ntt_error.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+/**
+ * In-place number-theoretic transform over BFieldElement.
+ *
+ * For n a power of two and omega = primitive_root_of_unity(n), forward()
+ * turns the coefficients of a polynomial f of degree below n into its
+ * values f(omega^i), in natural order; inverse() turns them back.
+ *
+ * The transform is an iterative decimation-in-time NTT: a bit-reversal
+ * permutation, blocked for lengths that outgrow the L1 cache, followed by
+ * radix-4 butterflies, so each pass over the array does two levels. The
+ * first levels, within blocks of 64 (or 16 or 8) values, go through
+ * shift-only kernels instead: the 64th roots of unity are powers of two,
+ * so their twiddles are a shift and a mod_reduce instead of a Montgomery
+ * multiplication. The twiddle factors of the other levels are computed on
+ * first use and cached for the lifetime of the process; all lengths share
+ * them.
+ *
+ * The overloads taking a ThreadPool use the four-step algorithm from
+ * 2^FOUR_STEP_MIN_LOG_LENGTH up: the length n = n1 * n2 array is
+ * transformed as n1 row NTTs of length n2, a twiddle scaling, and n2 row
+ * NTTs of length n1, with cache-blocked transposes in between. Every
+ * sub-transform fits in cache and the rows are spread over the pool. It
+ * needs a scratch buffer of n elements.
+ */
+class Ntt {
+public:
+    static constexpr size_t MAX_LOG_LENGTH = 30;
+    static constexpr size_t FOUR_STEP_MIN_LOG_LENGTH = 16;
+
+    // Throw NttError unless the length is a power of two up to 2^30
+    static void forward(std::vector<BFieldElement>& values);
+    static void inverse(std::vector<BFieldElement>& values);
+    static void forward(BFieldElement* values, size_t length);
+    static void inverse(BFieldElement* values, size_t length);
+    static void forward(std::vector<BFieldElement>& values, ThreadPool& pool);
+    static void inverse(std::vector<BFieldElement>& values, ThreadPool& pool);
+    static void forward(BFieldElement* values, size_t length, ThreadPool& pool);
+    static void inverse(BFieldElement* values, size_t length, ThreadPool& pool);
+
+    // forward() for length 8, 16 or 64 using only the shift-only kernels
+    static void forward_small(BFieldElement* values, size_t length);
+
+    // Moves values[i] to the bit-reversed index of i
+    static void bit_reverse(BFieldElement* values, size_t length);
+
+    // omega_{2^(level+1)}^j for j in [0, 2^level), where omega_m is
+    // primitive_root_of_unity(m)
+    static const BFieldElement* twiddles(size_t level);
+
+    static bool is_valid_length(size_t length) {
+        return length != 0 && (length & (length - 1)) == 0 && length <= (size_t{1} << MAX_LOG_LENGTH);
+    }
+};
+
+} // namespace tip5xx
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree_error.hpp"
+
+namespace tip5xx {
+
+/**
+ * Merkle tree that keeps earlier versions of itself.
+ *
+ * Nodes are immutable and reference counted. An update copies only the
+ * nodes on the paths from the changed leaves to the root and shares every
+ * other node with the version it was derived from, so a version costs
+ * O(k log n) nodes for k changed leaves. Releasing a version drops its
+ * references; nodes no retained version reaches are freed right away.
+ *
+ * Versions are numbered from 0 (the initial leaves) upwards. Updates are
+ * always applied to the newest tree, which is kept as the base for the
+ * next update even after its version has been released.
+ */
+class PersistentMerkleTree {
+public:
+    // The number of leaves must be a non-zero power of two
+    explicit PersistentMerkleTree(const std::vector<Digest>& leaves);
+
+    size_t num_leaves() const { return num_leaves_; }
+    size_t height() const { return height_; }
+    uint64_t latest_version() const { return next_version_ - 1; }
+
+    // Apply the updates to the newest tree and return the new version.
+    // Shared ancestors are hashed once, one level at a time with
+    // Tip5::hash_pair_batch. If an index occurs more than once, the last
+    // update wins.
+    uint64_t update(const std::vector<std::pair<size_t, Digest>>& leaf_updates);
+
+    Digest root(uint64_t version) const;
+    Digest leaf(uint64_t version, size_t leaf_index) const;
+    std::vector<Digest> authentication_path(uint64_t version, size_t leaf_index) const;
+
+    // Retained versions, oldest first
+    std::vector<uint64_t> versions() const;
+    void release(uint64_t version);
+    // Release all but the newest `count` retained versions
+    void retain_last(size_t count);
+
+    // Distinct nodes reachable from the retained versions and the newest tree
+    size_t num_stored_nodes() const;
+
+private:
+    struct Node {
+        Digest digest;
+        std::shared_ptr<const Node> left;
+        std::shared_ptr<const Node> right;
+    };
+    using NodePtr = std::shared_ptr<const Node>;
+    using LeafUpdate = std::pair<size_t, Digest>;
+
+    // Copy of `node`, rooted at `depth` with its first leaf at first_leaf,
+    // with the updates in [first, last) applied. New internal nodes are
+    // appended to fresh[depth] and hashed afterwards.
+    NodePtr path_copy(
+        const NodePtr& node,
+        size_t depth,
+        size_t first_leaf,
+        const LeafUpdate* first,
+        const LeafUpdate* last,
+        std::vector<std::vector<Node*>>& fresh) const;
+
+    const NodePtr& version_root(uint64_t version) const;
+    const Node& leaf_node(const NodePtr& root, size_t leaf_index) const;
+
+    size_t num_leaves_;
+    size_t height_;
+    uint64_t next_version_ = 1;
+    NodePtr latest_;
+    std::map<uint64_t, NodePtr> versions_;
+};
+
+} // namespace tip5xx
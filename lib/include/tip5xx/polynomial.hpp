@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/polynomial_error.hpp"
+
+namespace tip5xx {
+
+/**
+ * Univariate polynomial over BFieldElement.
+ *
+ * Coefficients are stored lowest degree first, without trailing zeros, so
+ * the zero polynomial has no coefficients and degree -1.
+ *
+ * Every operation has a quadratic and a quasi-linear algorithm and picks
+ * one by operand size: multiplication goes through Ntt, division with
+ * remainder through a Newton iteration for the inverse of the reversed
+ * divisor, and multipoint evaluation and interpolation through a
+ * subproduct tree of the points. The thresholds below were measured with
+ * bench/polynomial_bench.
+ */
+class Polynomial {
+public:
+    // Shorter factor, in coefficients, from which multiplication uses Ntt
+    static constexpr size_t NTT_MULTIPLICATION_THRESHOLD = 32;
+    // Quotient and divisor length from which division uses Newton iteration
+    static constexpr size_t NEWTON_DIVISION_THRESHOLD = 128;
+    // Number of points from which evaluate() and interpolate() use a
+    // subproduct tree
+    static constexpr size_t FAST_EVALUATION_THRESHOLD = 1024;
+    static constexpr size_t FAST_INTERPOLATION_THRESHOLD = 128;
+
+    Polynomial() = default;
+    explicit Polynomial(std::vector<BFieldElement> coefficients);
+
+    // The product of (x - root) over the roots
+    static Polynomial zerofier(const std::vector<BFieldElement>& roots);
+
+    // The polynomial of degree below points.size() through (points[i], values[i]).
+    // Throws PolynomialError on a length mismatch or a repeated point.
+    static Polynomial interpolate(const std::vector<BFieldElement>& points,
+                                  const std::vector<BFieldElement>& values);
+
+    const std::vector<BFieldElement>& coefficients() const { return coefficients_; }
+    int64_t degree() const { return static_cast<int64_t>(coefficients_.size()) - 1; }
+    bool is_zero() const { return coefficients_.empty(); }
+    BFieldElement leading_coefficient() const;
+
+    BFieldElement evaluate(const BFieldElement& point) const;
+    std::vector<BFieldElement> evaluate(const std::vector<BFieldElement>& points) const;
+
+    Polynomial derivative() const;
+
+    // (quotient, remainder) with deg remainder < deg divisor. Throws
+    // PolynomialError for a zero divisor.
+    std::pair<Polynomial, Polynomial> divide(const Polynomial& divisor) const;
+
+    Polynomial operator+(const Polynomial& rhs) const;
+    Polynomial operator-(const Polynomial& rhs) const;
+    Polynomial operator*(const Polynomial& rhs) const;
+    Polynomial operator*(const BFieldElement& scalar) const;
+    Polynomial operator/(const Polynomial& rhs) const { return divide(rhs).first; }
+    Polynomial operator%(const Polynomial& rhs) const { return divide(rhs).second; }
+    Polynomial operator-() const;
+
+    bool operator==(const Polynomial& rhs) const { return coefficients_ == rhs.coefficients_; }
+    bool operator!=(const Polynomial& rhs) const { return !(*this == rhs); }
+
+private:
+    std::vector<BFieldElement> coefficients_;
+
+    void normalize();
+};
+
+} // namespace tip5xx
@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/mapped_merkle_tree.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+/**
+ * Merkle tree built by independent workers, one per shard, and merged
+ * from the shard roots.
+ *
+ * The n leaves of a leaves file are split into num_shards equal ranges
+ * (both powers of two, num_shards <= n). Worker k runs build_shard(),
+ * typically in its own process or on its own host, and writes into a
+ * shared directory:
+ *   shard-<k>.tree   MappedMerkleTree over the leaves of shard k
+ *   shard-<k>.root   shard summary: 64-byte header (magic "TIP5SHR\0",
+ *                    format version, shard index, number of shards,
+ *                    total number of leaves; little-endian u64s, rest
+ *                    zero) followed by the shard root as Digest::to_bytes
+ * merge() reads only the summaries and writes top.tree, the
+ * MappedMerkleTree whose leaves are the shard roots. Its root is the root
+ * of the whole tree, equal to MerkleTree::build(leaves).root(). After
+ * open(), an authentication path is the shard's path followed by the
+ * top tree's path of the shard root.
+ */
+class ShardedMerkleTree {
+public:
+    static constexpr size_t SUMMARY_SIZE = 64 + Digest::BYTES;
+    static constexpr uint64_t VERSION = 1;
+
+    static std::string shard_tree_path(const std::string& dir, uint64_t shard_index);
+    static std::string shard_summary_path(const std::string& dir, uint64_t shard_index);
+    static std::string top_tree_path(const std::string& dir);
+
+    // Worker step: build shard `shard_index` and write its tree and
+    // summary into dir. Returns the shard root.
+    static Digest build_shard(const std::string& leaves_path, uint64_t shard_index, uint64_t num_shards,
+                              const std::string& dir);
+    static Digest build_shard(const std::string& leaves_path, uint64_t shard_index, uint64_t num_shards,
+                              const std::string& dir, ThreadPool& pool);
+
+    // Merge step: combine the summaries of all shards in dir into the top
+    // tree. Returns the root of the whole tree.
+    static Digest merge(const std::string& dir, uint64_t num_shards);
+
+    // Map the top tree and every shard tree of a merged directory
+    static ShardedMerkleTree open(const std::string& dir);
+
+    Digest root() const { return top_.root(); }
+    uint64_t num_leaves() const { return num_shards() * shard_num_leaves_; }
+    uint64_t num_shards() const { return top_.num_leaves(); }
+    size_t height() const { return shards_.front().height() + top_.height(); }
+
+    Digest leaf(uint64_t leaf_index) const;
+    std::vector<Digest> authentication_path(uint64_t leaf_index) const;
+
+private:
+    ShardedMerkleTree(MappedMerkleTree top, std::vector<MappedMerkleTree> shards)
+        : top_(std::move(top)), shards_(std::move(shards)), shard_num_leaves_(shards_.front().num_leaves()) {}
+
+    MappedMerkleTree top_;
+    std::vector<MappedMerkleTree> shards_;
+    uint64_t shard_num_leaves_;
+};
+
+} // namespace tip5xx
@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "tip5xx/digest.hpp"
+
+namespace tip5xx {
+
+// Authentication path of a sparse Merkle tree slot with the default
+// ("empty subtree") siblings left out
+struct SparseMerkleProof {
+    // Bit l is set iff the sibling at level l is not the default digest
+    uint64_t non_default_siblings = 0;
+    // The non-default siblings, from the leaf level up
+    std::vector<Digest> siblings;
+
+    // With value == std::nullopt this proves that the key's slot is empty
+    bool verify(const Digest& root, const Digest& key, const std::optional<Digest>& value) const;
+};
+
+/**
+ * Key/value commitment with 2^64 leaf slots.
+ *
+ * A key is stored in slot key[0]; keys must therefore differ in their
+ * first element, and inserting a key into a slot held by another throws
+ * MerkleTreeError::SlotOccupied. An
+ * occupied slot holds hash_pair(key, value), an empty slot the zero
+ * Digest. The digests of empty subtrees of every height are computed once
+ * and never stored, so the node maps only hold the paths of occupied slots.
+ */
+class SparseMerkleTree {
+public:
+    static constexpr size_t DEPTH = 64;
+
+    // default_digests()[l] is the root of an empty subtree of height l
+    static const std::array<Digest, DEPTH + 1>& default_digests();
+
+    static uint64_t slot(const Digest& key) { return key[0].value(); }
+    static Digest leaf_digest(const Digest& key, const Digest& value);
+
+    Digest root() const { return node(DEPTH, 0); }
+
+    std::optional<Digest> get(const Digest& key) const;
+    void insert(const Digest& key, const Digest& value) { update({{key, value}}); }
+    void remove(const Digest& key) { update({{key, std::nullopt}}); }
+
+    // Insert (value) or remove (std::nullopt) several keys, in order.
+    // Ancestors shared by the changed slots are rehashed once, level by
+    // level. If any insert hits a slot held by another key, nothing changes.
+    void update(const std::vector<std::pair<Digest, std::optional<Digest>>>& updates);
+
+    SparseMerkleProof prove(const Digest& key) const;
+
+    size_t size() const { return entries_.size(); }
+    size_t num_stored_nodes() const;
+
+private:
+    const Digest& node(size_t level, uint64_t index) const;
+
+    // Non-default nodes by level; level 0 holds the leaves, level DEPTH the root
+    std::array<std::unordered_map<uint64_t, Digest>, DEPTH + 1> nodes_;
+    std::unordered_map<uint64_t, std::pair<Digest, Digest>> entries_;
+};
+
+} // namespace tip5xx
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/thread_pool.hpp"
+
+namespace tip5xx {
+
+/**
+ * Merkle tree that stores only the leaves and every level_stride-th level
+ * above them (plus the root), and recomputes the levels in between when
+ * serving authentication paths.
+ *
+ * With stride k, the stored levels take about n / (2^k - 1) digests on top
+ * of the n leaves, against n for MerkleTree; a path costs about
+ * (height / k) * (2^k - 1) hash_pair calls, batched per level, against
+ * none. Stride 1 stores every level and never hashes.
+ */
+class StridedMerkleTree {
+public:
+    // The number of leaves must be a non-zero power of two; level_stride >= 1
+    static StridedMerkleTree build(const std::vector<Digest>& leaves, size_t level_stride);
+    static StridedMerkleTree build(const std::vector<Digest>& leaves, size_t level_stride, ThreadPool& pool);
+
+    Digest root() const { return levels_.back().front(); }
+    size_t num_leaves() const { return levels_.front().size(); }
+    size_t height() const { return height_; }
+    size_t level_stride() const { return level_stride_; }
+
+    const Digest& leaf(size_t leaf_index) const;
+
+    // Same path as MerkleTree::authentication_path
+    std::vector<Digest> authentication_path(size_t leaf_index) const;
+
+    // Digests held, leaves included
+    size_t num_stored_digests() const;
+
+private:
+    StridedMerkleTree(size_t height, size_t level_stride, std::vector<std::vector<Digest>> levels)
+        : height_(height), level_stride_(level_stride), levels_(std::move(levels)) {}
+
+    size_t height_;
+    size_t level_stride_;
+    // levels_[j] is level j * level_stride (0 being the leaves); the last
+    // entry is the root level
+    std::vector<std::vector<Digest>> levels_;
+};
+
+} // namespace tip5xx
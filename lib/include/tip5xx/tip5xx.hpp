@@ -112,12 +112,26 @@ public:
         return static_cast<uint16_t>((xxx + 256) % 257);
     }
     void mds_generated();
+    // The same circulant MDS layer as a cyclic convolution through
+    // shift-only length-16 NTTs
+    void mds_ntt();
 
     // Hash functions
     static std::array<BFieldElement, Digest::LEN> hash_10(const std::array<BFieldElement, RATE>& input);
     static Digest hash_pair(const Digest& left, const Digest& right);
+    // hash_pair with the first capacity element set to domain_tag instead
+    // of one. Each tag other than one and zero is a fixed-length domain of
+    // its own, so the tag is bound without spending rate on it.
+    static Digest hash_pair(const Digest& left, const Digest& right, BFieldElement domain_tag);
     static Digest hash_varlen(const std::vector<BFieldElement>& input);
 
+    // out[i] = hash_pair(left[i], right[i]) for i < count. NUM_LANES
+    // permutations are interleaved so that they can share vector registers.
+    static void hash_pair_batch(const Digest* left, const Digest* right, Digest* out, size_t count);
+    // out[i] = hash_pair(left[i], right[i], domain_tags[i]) for i < count
+    static void hash_pair_batch(const Digest* left, const Digest* right, const BFieldElement* domain_tags,
+                                Digest* out, size_t count);
+
     // Sampling functions
     std::vector<uint32_t> sample_indices(uint32_t upper_bound, size_t num_indices);
 
@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "tip5xx/digest.hpp"
+#include "tip5xx/merkle_tree.hpp"
+
+namespace tip5xx {
+
+/**
+ * Merkle tree with its nodes stored in van Emde Boas order.
+ *
+ * The unit of the layout is a pair of siblings; the pairs form a binary
+ * tree of their own (the pair holding nodes 2p and 2p + 1 is the parent of
+ * the pairs 2p and 2p + 1). A tree of L levels is split into a top tree of
+ * floor(L/2) levels and the bottom trees hanging off it; the top tree is
+ * stored first, followed by every bottom tree, each laid out the same way
+ * recursively. An authentication path, which is exactly the chain of pairs
+ * from a leaf to the root, then touches O(log_B n) blocks of B pairs for
+ * every block size B at once, where the level-order layout of MerkleTree
+ * touches one block per level. The root is stored in front of the pairs.
+ *
+ * Node indices in the interface are the level-order ones of MerkleTree.
+ * build() hashes straight into the layout, without a level-order copy.
+ *
+ * Measured with merkle_layout_bench on a 300 MiB L3 machine, the extra
+ * address arithmetic outweighs the saved cache misses: level order is
+ * faster per path at 2^22 and at 2^25 leaves alike.
+ */
+class VebMerkleTree {
+public:
+    explicit VebMerkleTree(const MerkleTree& tree);
+    static VebMerkleTree build(const std::vector<Digest>& leaves);
+
+    Digest root() const { return nodes_[0]; }
+    size_t num_leaves() const { return (nodes_.size() + 1) / 2; }
+    size_t height() const { return height_; }
+
+    const Digest& node(size_t node_index) const;
+    const Digest& leaf(size_t leaf_index) const;
+    std::vector<Digest> authentication_path(size_t leaf_index) const;
+    // Write the height() digests of the path to `path` without allocating
+    void authentication_path(size_t leaf_index, Digest* path) const;
+
+    // Position in vEB order of the element at `depth` (0 is the root) with
+    // index `index` within its level, in a tree of num_levels levels
+    static size_t position(size_t num_levels, size_t depth, uint64_t index);
+
+private:
+    // Empty tree of the given height with its split tables filled in
+    explicit VebMerkleTree(size_t height);
+
+    // Position of the node with the given level-order index in nodes_
+    size_t slot(size_t node_index) const;
+
+    // vEB positions of the pairs on the path from the root pair down to
+    // the pair holding the given leaf
+    void path_positions(size_t leaf_index, size_t* positions) const;
+
+    size_t height_;
+    std::vector<Digest> nodes_;
+
+    // Every depth d > 0 of the pair tree is the first level of the bottom
+    // trees of exactly one recursive split. For that split,
+    // top_root_depth_[d] is the depth of the split tree's root, and
+    // top_size_[d] and bottom_size_[d] the number of pairs in its top tree
+    // and in each of its bottom trees.
+    std::vector<size_t> top_root_depth_;
+    std::vector<size_t> top_size_;
+    std::vector<size_t> bottom_size_;
+};
+
+} // namespace tip5xx
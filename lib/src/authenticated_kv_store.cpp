@@ -0,0 +1,312 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include "tip5xx/authenticated_kv_store.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+uint32_t leading_zeros(uint64_t x) {
+    uint32_t count = 0;
+    for (uint32_t shift = 32; shift > 0; shift /= 2) {
+        if ((x >> (64 - shift)) == 0) {
+            count += shift;
+            x <<= shift;
+        }
+    }
+    return count;
+}
+
+// First bit in which two different keys differ
+uint32_t first_difference(const Digest& a, const Digest& b) {
+    for (size_t i = 0; i < Digest::LEN; i++) {
+        uint64_t x = a[i].value() ^ b[i].value();
+        if (x != 0) {
+            return static_cast<uint32_t>(64 * i) + leading_zeros(x);
+        }
+    }
+    return AuthenticatedKvStore::KEY_BITS;
+}
+
+} // namespace
+
+Digest AuthenticatedKvStore::leaf_digest(const Digest& key, const Digest& value) {
+    std::vector<BFieldElement> input(key.values().begin(), key.values().end());
+    input.insert(input.end(), value.values().begin(), value.values().end());
+    return Tip5::hash_varlen(input);
+}
+
+BFieldElement AuthenticatedKvStore::branch_tag(uint32_t bit) {
+    // Zero and one are the capacity of the sponge's own domains
+    return BFieldElement::new_element(uint64_t{bit} + 2);
+}
+
+Digest AuthenticatedKvStore::branch_digest(uint32_t bit, const Digest& left, const Digest& right) {
+    return Tip5::hash_pair(left, right, branch_tag(bit));
+}
+
+bool AuthenticatedKvStore::key_bit(const Digest& key, uint32_t bit) {
+    return ((key[bit / 64].value() >> (63 - bit % 64)) & 1) != 0;
+}
+
+uint32_t AuthenticatedKvStore::new_node(Node node) {
+    if (!free_.empty()) {
+        uint32_t index = free_.back();
+        free_.pop_back();
+        nodes_[index] = node;
+        return index;
+    }
+    nodes_.push_back(node);
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+void AuthenticatedKvStore::free_node(uint32_t index) {
+    free_.push_back(index);
+}
+
+uint32_t AuthenticatedKvStore::find_leaf(const Digest& key) const {
+    uint32_t index = root_;
+    while (!nodes_[index].is_leaf()) {
+        const Node& node = nodes_[index];
+        index = key_bit(key, node.bit) ? node.right : node.left;
+    }
+    return index;
+}
+
+std::optional<Digest> AuthenticatedKvStore::get(const Digest& key) const {
+    if (root_ == NONE) {
+        return std::nullopt;
+    }
+    const Node& leaf = nodes_[find_leaf(key)];
+    if (leaf.key != key) {
+        return std::nullopt;
+    }
+    return leaf.value;
+}
+
+void AuthenticatedKvStore::put(const Digest& key, const Digest& value) {
+    if (root_ == NONE) {
+        root_ = new_node({Digest(), key, value});
+        size_++;
+        changed_ = true;
+        return;
+    }
+
+    const Node& found = nodes_[find_leaf(key)];
+    if (found.key == key && found.value == value) {
+        return;
+    }
+    changed_ = true;
+    const uint32_t split = first_difference(key, found.key);
+
+    // Allocate before taking pointers into nodes_
+    uint32_t leaf = NONE;
+    uint32_t branch = NONE;
+    if (split != KEY_BITS) {
+        leaf = new_node({Digest(), key, value});
+        branch = new_node({});
+        size_++;
+    }
+
+    // Walk down to the link that the new branch takes over, or to the
+    // key's own leaf, flagging the path
+    uint32_t* link = &root_;
+    while (!nodes_[*link].is_leaf() && nodes_[*link].bit < split) {
+        Node& node = nodes_[*link];
+        node.dirty = true;
+        link = key_bit(key, node.bit) ? &node.right : &node.left;
+    }
+
+    if (split == KEY_BITS) {
+        nodes_[*link].value = value;
+        nodes_[*link].dirty = true;
+        return;
+    }
+    Node& new_branch = nodes_[branch];
+    new_branch.bit = split;
+    new_branch.left = key_bit(key, split) ? *link : leaf;
+    new_branch.right = key_bit(key, split) ? leaf : *link;
+    *link = branch;
+}
+
+void AuthenticatedKvStore::remove(const Digest& key) {
+    if (root_ == NONE || nodes_[find_leaf(key)].key != key) {
+        return;
+    }
+    changed_ = true;
+
+    uint32_t* parent_link = nullptr;
+    uint32_t* link = &root_;
+    while (!nodes_[*link].is_leaf()) {
+        Node& node = nodes_[*link];
+        node.dirty = true;
+        parent_link = link;
+        link = key_bit(key, node.bit) ? &node.right : &node.left;
+    }
+
+    free_node(*link);
+    size_--;
+    if (parent_link == nullptr) {
+        root_ = NONE;
+        return;
+    }
+
+    // The leaf's sibling takes the place of their parent
+    uint32_t parent = *parent_link;
+    const Node& node = nodes_[parent];
+    *parent_link = link == &node.left ? node.right : node.left;
+    free_node(parent);
+}
+
+void AuthenticatedKvStore::update(const std::vector<std::pair<Digest, std::optional<Digest>>>& updates) {
+    for (const auto& [key, value] : updates) {
+        if (value) {
+            put(key, *value);
+        } else {
+            remove(key);
+        }
+    }
+}
+
+bool AuthenticatedKvStore::has_uncommitted_changes() const {
+    return changed_;
+}
+
+Digest AuthenticatedKvStore::commit() {
+    changed_ = false;
+    if (root_ == NONE) {
+        root_digest_ = Digest();
+        return root_digest_;
+    }
+
+    // Post-order over the flagged nodes; clean subtrees keep their digests.
+    // Leaves are hashed on the way, and every flagged branch is queued at
+    // its height above the flagged nodes below it, so that a level only
+    // depends on the levels before it.
+    std::vector<std::vector<uint32_t>> levels;
+    std::vector<uint32_t> heights(nodes_.size(), 0);
+    std::vector<std::pair<uint32_t, bool>> pending;
+    if (nodes_[root_].dirty) {
+        pending.emplace_back(root_, false);
+    }
+    while (!pending.empty()) {
+        auto [index, children_done] = pending.back();
+        pending.pop_back();
+        Node& node = nodes_[index];
+        if (node.is_leaf()) {
+            node.digest = leaf_digest(node.key, node.value);
+            node.dirty = false;
+        } else if (!children_done) {
+            pending.emplace_back(index, true);
+            for (uint32_t child : {node.left, node.right}) {
+                if (nodes_[child].dirty) {
+                    pending.emplace_back(child, false);
+                }
+            }
+        } else {
+            uint32_t height = 1 + std::max(heights[node.left], heights[node.right]);
+            heights[index] = height;
+            if (levels.size() < height) {
+                levels.resize(height);
+            }
+            levels[height - 1].push_back(index);
+        }
+    }
+
+    std::vector<Digest> lefts, rights, digests;
+    std::vector<BFieldElement> tags;
+    for (const auto& level : levels) {
+        lefts.clear();
+        rights.clear();
+        tags.clear();
+        for (uint32_t index : level) {
+            const Node& node = nodes_[index];
+            lefts.push_back(nodes_[node.left].digest);
+            rights.push_back(nodes_[node.right].digest);
+            tags.push_back(branch_tag(node.bit));
+        }
+        digests.resize(level.size());
+        Tip5::hash_pair_batch(lefts.data(), rights.data(), tags.data(), digests.data(), level.size());
+        for (size_t i = 0; i < level.size(); i++) {
+            nodes_[level[i]].digest = digests[i];
+            nodes_[level[i]].dirty = false;
+        }
+    }
+
+    root_digest_ = nodes_[root_].digest;
+    return root_digest_;
+}
+
+KvProof AuthenticatedKvStore::prove(const Digest& key) const {
+    if (has_uncommitted_changes()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::UncommittedChanges, "proof requested");
+    }
+
+    KvProof proof;
+    if (root_ == NONE) {
+        return proof;
+    }
+    uint32_t index = root_;
+    while (!nodes_[index].is_leaf()) {
+        const Node& node = nodes_[index];
+        bool go_right = key_bit(key, node.bit);
+        proof.bits.push_back(node.bit);
+        proof.siblings.push_back(nodes_[go_right ? node.left : node.right].digest);
+        index = go_right ? node.right : node.left;
+    }
+    proof.leaf.emplace(nodes_[index].key, nodes_[index].value);
+    return proof;
+}
+
+bool KvProof::verify(const Digest& root, const Digest& key, const std::optional<Digest>& value) const {
+    if (!leaf) {
+        return bits.empty() && siblings.empty() && !value && root == Digest();
+    }
+    const auto& [leaf_key, leaf_value] = *leaf;
+    if (bits.size() != siblings.size()) {
+        return false;
+    }
+    if (value ? (leaf_key != key || leaf_value != *value) : leaf_key == key) {
+        return false;
+    }
+
+    // Split bits grow downwards, and the leaf must lie on the key's path
+    for (size_t i = 0; i < bits.size(); i++) {
+        if (bits[i] >= AuthenticatedKvStore::KEY_BITS || (i > 0 && bits[i] <= bits[i - 1]) ||
+            AuthenticatedKvStore::key_bit(leaf_key, bits[i]) != AuthenticatedKvStore::key_bit(key, bits[i])) {
+            return false;
+        }
+    }
+
+    Digest acc = AuthenticatedKvStore::leaf_digest(leaf_key, leaf_value);
+    for (size_t i = bits.size(); i-- > 0;) {
+        acc = AuthenticatedKvStore::key_bit(key, bits[i])
+            ? AuthenticatedKvStore::branch_digest(bits[i], siblings[i], acc)
+            : AuthenticatedKvStore::branch_digest(bits[i], acc, siblings[i]);
+    }
+    return acc == root;
+}
+
+} // namespace tip5xx
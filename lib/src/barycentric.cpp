@@ -0,0 +1,162 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include "tip5xx/barycentric.hpp"
+#include "tip5xx/ntt.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Columns whose weighted sums share one pass over the weights
+constexpr size_t COLUMNS_PER_PASS = 4;
+
+// sum_i values[c][i] * weights[i] for COLUMNS columns of the given stride.
+// The Montgomery products a R * b R are summed unreduced in 128 bits with
+// a carry count, reduced mod p once, and a final montyred removes the extra R.
+template <size_t COLUMNS>
+void weighted_sums(const BFieldElement* values, size_t stride, const BFieldElement* weights, size_t length,
+                   BFieldElement* sums) {
+    __uint128_t accumulators[COLUMNS] = {};
+    uint64_t carries[COLUMNS] = {};
+    for (size_t i = 0; i < length; i++) {
+        const __uint128_t weight = weights[i].raw_u64();
+        for (size_t c = 0; c < COLUMNS; c++) {
+            const __uint128_t product = weight * values[c * stride + i].raw_u64();
+            accumulators[c] += product;
+            carries[c] += accumulators[c] < product;
+        }
+    }
+
+    // 2^128 = -2^32 mod p
+    constexpr uint64_t TWO_POW_128 = BFieldElement::P - (uint64_t{1} << 32);
+    for (size_t c = 0; c < COLUMNS; c++) {
+        __uint128_t total = static_cast<__uint128_t>(BFieldElement::mod_reduce(accumulators[c])) +
+                            static_cast<__uint128_t>(carries[c]) * TWO_POW_128;
+        uint64_t reduced = BFieldElement::mod_reduce(total);
+        if (reduced >= BFieldElement::P) {
+            reduced -= BFieldElement::P;
+        }
+        sums[c] = BFieldElement::from_raw_u64(BFieldElement::montyred(reduced));
+    }
+}
+
+} // namespace
+
+BarycentricEvaluator::BarycentricEvaluator(size_t domain_length, const BFieldElement& domain_offset) {
+    if (!Ntt::is_valid_length(domain_length) || domain_offset.is_zero()) {
+        throw NttError(NttError::ErrorType::InvalidLength,
+                       "barycentric domain of length " + std::to_string(domain_length));
+    }
+    const BFieldElement omega = BFieldElement::primitive_root_of_unity(domain_length);
+    domain_.resize(domain_length);
+    BFieldElement point = domain_offset;
+    for (auto& x : domain_) {
+        x = point;
+        point *= omega;
+    }
+    offset_power_ = domain_offset.mod_pow(domain_length);
+    normalizer_ = (BFieldElement::new_element(domain_length) * offset_power_).inverse();
+}
+
+BFieldElement BarycentricEvaluator::evaluate(const std::vector<BFieldElement>& values,
+                                             const BFieldElement& point) const {
+    if (values.size() != domain_length()) {
+        throw NttError(NttError::ErrorType::InvalidLength,
+                       std::to_string(values.size()) + " values on a domain of " + std::to_string(domain_length()));
+    }
+    return evaluate_columns(values, point, nullptr)[0];
+}
+
+std::vector<BFieldElement> BarycentricEvaluator::evaluate_columns(const std::vector<BFieldElement>& columns,
+                                                                  const BFieldElement& point) const {
+    return evaluate_columns(columns, point, nullptr);
+}
+
+std::vector<BFieldElement> BarycentricEvaluator::evaluate_columns(const std::vector<BFieldElement>& columns,
+                                                                  const BFieldElement& point,
+                                                                  ThreadPool& pool) const {
+    return evaluate_columns(columns, point, &pool);
+}
+
+std::vector<BFieldElement> BarycentricEvaluator::evaluate_columns(const std::vector<BFieldElement>& columns,
+                                                                  const BFieldElement& point,
+                                                                  ThreadPool* pool) const {
+    const size_t n = domain_length();
+    if (columns.size() % n != 0) {
+        throw NttError(NttError::ErrorType::InvalidLength,
+                       std::to_string(columns.size()) + " values for columns of " + std::to_string(n));
+    }
+    const size_t num_columns = columns.size() / n;
+    std::vector<BFieldElement> results(num_columns);
+
+    // Inside the domain the interpolant is the value itself; x_i = point
+    // iff point^n = offset^n, and then i follows from point / offset
+    const BFieldElement point_power = point.mod_pow(n);
+    if (point_power == offset_power_) {
+        size_t index = 0;
+        while (domain_[index] != point) {
+            index++;
+        }
+        for (size_t c = 0; c < num_columns; c++) {
+            results[c] = columns[c * n + index];
+        }
+        return results;
+    }
+
+    std::vector<BFieldElement> weights(n);
+    for (size_t i = 0; i < n; i++) {
+        weights[i] = point - domain_[i];
+    }
+    weights = BFieldElement::batch_inversion(std::move(weights));
+    for (size_t i = 0; i < n; i++) {
+        weights[i] *= domain_[i];
+    }
+    const BFieldElement scale = (point_power - offset_power_) * normalizer_;
+
+    const size_t num_passes = (num_columns + COLUMNS_PER_PASS - 1) / COLUMNS_PER_PASS;
+    auto pass = [&](size_t p) {
+        const size_t first = p * COLUMNS_PER_PASS;
+        BFieldElement* sums = results.data() + first;
+        const BFieldElement* values = columns.data() + first * n;
+        switch (std::min(COLUMNS_PER_PASS, num_columns - first)) {
+            case 4: weighted_sums<4>(values, n, weights.data(), n, sums); break;
+            case 3: weighted_sums<3>(values, n, weights.data(), n, sums); break;
+            case 2: weighted_sums<2>(values, n, weights.data(), n, sums); break;
+            default: weighted_sums<1>(values, n, weights.data(), n, sums); break;
+        }
+        for (size_t c = first; c < std::min(first + COLUMNS_PER_PASS, num_columns); c++) {
+            results[c] *= scale;
+        }
+    };
+    if (pool) {
+        pool->parallel_for(0, num_passes, pass);
+    } else {
+        for (size_t p = 0; p < num_passes; p++) {
+            pass(p);
+        }
+    }
+    return results;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,182 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <thread>
+#include "tip5xx/concurrent_merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+void ConcurrentMerkleTree::VersionedDigest::store(const Digest& digest) {
+    // Writers of the same digest take turns by moving the counter from
+    // even to odd
+    uint64_t seq = sequence.load(std::memory_order_relaxed);
+    while ((seq & 1) != 0 ||
+           !sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+        std::this_thread::yield();
+        seq = sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < Digest::LEN; i++) {
+        words[i].store(digest[i].raw_u64(), std::memory_order_relaxed);
+    }
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+Digest ConcurrentMerkleTree::VersionedDigest::load(uint64_t* sequence_out) const {
+    Digest digest;
+    while (true) {
+        uint64_t before = sequence.load(std::memory_order_acquire);
+        if ((before & 1) == 0) {
+            for (size_t i = 0; i < Digest::LEN; i++) {
+                digest[i] = BFieldElement::from_raw_u64(words[i].load(std::memory_order_relaxed));
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                if (sequence_out != nullptr) {
+                    *sequence_out = before;
+                }
+                return digest;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+ConcurrentMerkleTree::ConcurrentMerkleTree(const std::vector<Digest>& leaves)
+    : num_leaves_(leaves.size()),
+      leaves_(leaves.size()),
+      dirty_(2 * leaves.size()),
+      committed_(MerkleTree::build(leaves).nodes()) {
+
+    for (size_t i = 0; i < num_leaves_; i++) {
+        for (size_t j = 0; j < Digest::LEN; j++) {
+            leaves_[i].words[j].store(leaves[i][j].raw_u64(), std::memory_order_relaxed);
+        }
+    }
+    for (auto& flag : dirty_) {
+        flag.store(false, std::memory_order_relaxed);
+    }
+    for (size_t j = 0; j < Digest::LEN; j++) {
+        published_root_.words[j].store(committed_[MerkleTree::ROOT_INDEX][j].raw_u64(), std::memory_order_relaxed);
+    }
+}
+
+size_t ConcurrentMerkleTree::height() const {
+    size_t height = 0;
+    while ((num_leaves_ >> height) > 1) {
+        height++;
+    }
+    return height;
+}
+
+void ConcurrentMerkleTree::check_leaf_index(size_t leaf_index) const {
+    if (leaf_index >= num_leaves_) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+}
+
+void ConcurrentMerkleTree::set_leaf(size_t leaf_index, const Digest& leaf) {
+    check_leaf_index(leaf_index);
+    leaves_[leaf_index].store(leaf);
+
+    // Flags are set bottom-up and cleared top-down by commit(), so an
+    // ancestor that is already flagged has not been visited by a commit
+    // yet, and neither have the flags below it
+    for (size_t node_index = num_leaves_ + leaf_index; node_index != 0; node_index /= 2) {
+        if (dirty_[node_index].exchange(true)) {
+            break;
+        }
+    }
+}
+
+Digest ConcurrentMerkleTree::leaf(size_t leaf_index) const {
+    check_leaf_index(leaf_index);
+    return leaves_[leaf_index].load();
+}
+
+MerkleRootSnapshot ConcurrentMerkleTree::commit() {
+    std::lock_guard<std::mutex> lock(commit_mutex_);
+    const size_t tree_height = height();
+
+    // levels[d] holds the flagged nodes at depth d, in ascending order
+    std::vector<std::vector<size_t>> levels(tree_height + 1);
+    if (dirty_[MerkleTree::ROOT_INDEX].exchange(false)) {
+        levels[0].push_back(MerkleTree::ROOT_INDEX);
+    }
+    for (size_t depth = 0; depth < tree_height; depth++) {
+        for (size_t node_index : levels[depth]) {
+            for (size_t child : {2 * node_index, 2 * node_index + 1}) {
+                if (dirty_[child].exchange(false)) {
+                    levels[depth + 1].push_back(child);
+                }
+            }
+        }
+    }
+
+    for (size_t node_index : levels[tree_height]) {
+        committed_[node_index] = leaves_[node_index - num_leaves_].load();
+    }
+
+    std::vector<Digest> left;
+    std::vector<Digest> right;
+    std::vector<Digest> hashed;
+    for (size_t depth = tree_height; depth-- > 0;) {
+        const auto& level = levels[depth];
+        left.resize(level.size());
+        right.resize(level.size());
+        hashed.resize(level.size());
+        for (size_t i = 0; i < level.size(); i++) {
+            left[i] = committed_[2 * level[i]];
+            right[i] = committed_[2 * level[i] + 1];
+        }
+        Tip5::hash_pair_batch(left.data(), right.data(), hashed.data(), level.size());
+        for (size_t i = 0; i < level.size(); i++) {
+            committed_[level[i]] = hashed[i];
+        }
+    }
+
+    const Digest& root = committed_[MerkleTree::ROOT_INDEX];
+    published_root_.store(root);
+    return {published_root_.sequence.load(std::memory_order_relaxed) / 2, root};
+}
+
+MerkleRootSnapshot ConcurrentMerkleTree::snapshot() const {
+    uint64_t sequence = 0;
+    Digest root = published_root_.load(&sequence);
+    return {sequence / 2, root};
+}
+
+std::vector<Digest> ConcurrentMerkleTree::authentication_path(size_t leaf_index) const {
+    check_leaf_index(leaf_index);
+    std::lock_guard<std::mutex> lock(commit_mutex_);
+
+    std::vector<Digest> path;
+    path.reserve(height());
+    for (size_t node_index = num_leaves_ + leaf_index; node_index > MerkleTree::ROOT_INDEX; node_index /= 2) {
+        path.push_back(committed_[node_index ^ 1]);
+    }
+    return path;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,296 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include "tip5xx/fri.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Codeword values folded or leaves hashed by one task
+constexpr size_t CHUNK = 4096;
+
+size_t log2_exact(size_t n) {
+    size_t log = 0;
+    while ((n >> log) > 1) {
+        log++;
+    }
+    return log;
+}
+
+bool is_power_of_two(size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+// Fiat-Shamir transcript on a variable-length Tip5 sponge
+class Transcript {
+public:
+    explicit Transcript(const FriParameters& parameters) {
+        absorb({parameters.domain_offset,
+                BFieldElement::new_element(parameters.domain_length),
+                BFieldElement::new_element(parameters.expansion_factor),
+                BFieldElement::new_element(parameters.num_queries)});
+    }
+
+    // Padded with a one and zeros to a multiple of RATE, as hash_varlen does
+    void absorb(const std::vector<BFieldElement>& elements) {
+        std::array<BFieldElement, RATE> chunk;
+        size_t pos = 0;
+        for (size_t i = 0; i <= elements.size(); i++) {
+            chunk[pos++] = i < elements.size() ? elements[i] : BFieldElement::one();
+            if (pos == RATE || i == elements.size()) {
+                std::fill(chunk.begin() + pos, chunk.end(), BFieldElement::zero());
+                sponge_.absorb(chunk);
+                pos = 0;
+            }
+        }
+    }
+
+    void absorb(const Digest& digest) {
+        absorb(std::vector<BFieldElement>(digest.values().begin(), digest.values().end()));
+    }
+
+    BFieldElement sample() {
+        return sponge_.squeeze()[0];
+    }
+
+    std::vector<uint32_t> sample_indices(size_t upper_bound, size_t num_indices) {
+        return sponge_.sample_indices(static_cast<uint32_t>(upper_bound), num_indices);
+    }
+
+private:
+    Tip5 sponge_{Domain::VariableLength};
+};
+
+BFieldElement fold_pair(const BFieldElement& first, const BFieldElement& second,
+                        const BFieldElement& alpha_over_x, const BFieldElement& two_inverse) {
+    const BFieldElement one = BFieldElement::one();
+    return two_inverse * ((one + alpha_over_x) * first + (one - alpha_over_x) * second);
+}
+
+} // namespace
+
+size_t FriParameters::num_rounds() const {
+    return log2_exact(domain_length / expansion_factor);
+}
+
+Fri::Fri(const FriParameters& parameters) : parameters_(parameters) {
+    if (!is_power_of_two(parameters.domain_length) || parameters.domain_length > (size_t{1} << 32)) {
+        throw FriError(FriError::ErrorType::InvalidParameters,
+                       "domain length " + std::to_string(parameters.domain_length));
+    }
+    if (!is_power_of_two(parameters.expansion_factor) || parameters.expansion_factor < 2 ||
+        parameters.expansion_factor > parameters.domain_length) {
+        throw FriError(FriError::ErrorType::InvalidParameters,
+                       "expansion factor " + std::to_string(parameters.expansion_factor));
+    }
+    if (parameters.num_queries == 0) {
+        throw FriError(FriError::ErrorType::InvalidParameters, "no queries");
+    }
+    if (parameters.domain_offset == BFieldElement::zero()) {
+        throw FriError(FriError::ErrorType::InvalidParameters, "zero domain offset");
+    }
+}
+
+Digest Fri::leaf_digest(const BFieldElement& first, const BFieldElement& second) {
+    const BFieldElement zero = BFieldElement::zero();
+    return Tip5::hash_pair(Digest({first, second, zero, zero, zero}), Digest({zero, zero, zero, zero, zero}));
+}
+
+MerkleTree Fri::commit(const std::vector<BFieldElement>& codeword, ThreadPool& pool) {
+    const size_t half = codeword.size() / 2;
+    std::vector<Digest> leaves(half);
+    const size_t num_chunks = (half + CHUNK - 1) / CHUNK;
+    pool.parallel_for(0, num_chunks, [&codeword, &leaves, half](size_t chunk) {
+        const BFieldElement zero = BFieldElement::zero();
+        size_t first = chunk * CHUNK;
+        size_t last = std::min(first + CHUNK, half);
+        std::vector<Digest> pairs(last - first);
+        std::vector<Digest> padding(last - first, Digest({zero, zero, zero, zero, zero}));
+        for (size_t i = first; i < last; i++) {
+            pairs[i - first] = Digest({codeword[i], codeword[i + half], zero, zero, zero});
+        }
+        Tip5::hash_pair_batch(pairs.data(), padding.data(), leaves.data() + first, last - first);
+    });
+    return MerkleTree::build(leaves, pool);
+}
+
+std::vector<BFieldElement> Fri::fold(
+    const std::vector<BFieldElement>& codeword,
+    const BFieldElement& offset,
+    const BFieldElement& challenge,
+    ThreadPool& pool) {
+
+    const size_t half = codeword.size() / 2;
+    const BFieldElement omega_inverse = BFieldElement::primitive_root_of_unity(codeword.size()).inverse();
+    const BFieldElement offset_inverse = offset.inverse();
+    const BFieldElement two_inverse = BFieldElement::new_element(2).inverse();
+
+    std::vector<BFieldElement> folded(half);
+    const size_t num_chunks = (half + CHUNK - 1) / CHUNK;
+    pool.parallel_for(0, num_chunks, [&](size_t chunk) {
+        size_t first = chunk * CHUNK;
+        size_t last = std::min(first + CHUNK, half);
+        // 1/x for x = offset * omega^i
+        BFieldElement x_inverse = offset_inverse * omega_inverse.mod_pow(first);
+        for (size_t i = first; i < last; i++) {
+            folded[i] = fold_pair(codeword[i], codeword[i + half], challenge * x_inverse, two_inverse);
+            x_inverse *= omega_inverse;
+        }
+    });
+    return folded;
+}
+
+FriProof Fri::prove(const std::vector<BFieldElement>& codeword) const {
+    return prove(codeword, ThreadPool::shared());
+}
+
+FriProof Fri::prove(const std::vector<BFieldElement>& codeword, ThreadPool& pool) const {
+    if (codeword.size() != parameters_.domain_length) {
+        throw FriError(FriError::ErrorType::CodewordLengthMismatch,
+                       std::to_string(codeword.size()) + " for " + std::to_string(parameters_.domain_length));
+    }
+
+    Transcript transcript(parameters_);
+    const size_t num_rounds = parameters_.num_rounds();
+    std::vector<std::vector<BFieldElement>> codewords;
+    std::vector<MerkleTree> trees;
+    codewords.reserve(num_rounds);
+    trees.reserve(num_rounds);
+
+    std::vector<BFieldElement> current = codeword;
+    BFieldElement offset = parameters_.domain_offset;
+    for (size_t round = 0; round < num_rounds; round++) {
+        trees.push_back(commit(current, pool));
+        transcript.absorb(trees.back().root());
+        BFieldElement challenge = transcript.sample();
+        auto folded = fold(current, offset, challenge, pool);
+        codewords.push_back(std::move(current));
+        current = std::move(folded);
+        offset = offset * offset;
+    }
+
+    FriProof proof;
+    proof.last_codeword = std::move(current);
+    transcript.absorb(proof.last_codeword);
+    const auto queries = transcript.sample_indices(parameters_.domain_length / 2, parameters_.num_queries);
+
+    proof.rounds.resize(num_rounds);
+    pool.parallel_for(0, num_rounds, [&](size_t round) {
+        const size_t half = codewords[round].size() / 2;
+        std::vector<size_t> leaf_indices;
+        auto& round_proof = proof.rounds[round];
+        round_proof.root = trees[round].root();
+        for (uint32_t query : queries) {
+            size_t leaf_index = query % half;
+            leaf_indices.push_back(leaf_index);
+            round_proof.revealed.push_back({codewords[round][leaf_index], codewords[round][leaf_index + half]});
+        }
+        round_proof.opening = MerkleMultiProof::generate(trees[round], leaf_indices);
+    });
+    return proof;
+}
+
+bool Fri::verify(const FriProof& proof) const {
+    const size_t num_rounds = parameters_.num_rounds();
+    const size_t num_queries = parameters_.num_queries;
+    if (proof.rounds.size() != num_rounds ||
+        proof.last_codeword.size() != (parameters_.domain_length >> num_rounds)) {
+        return false;
+    }
+
+    // The last codeword must come from a constant polynomial
+    for (const auto& value : proof.last_codeword) {
+        if (value != proof.last_codeword.front()) {
+            return false;
+        }
+    }
+
+    Transcript transcript(parameters_);
+    std::vector<BFieldElement> challenges;
+    for (const auto& round_proof : proof.rounds) {
+        transcript.absorb(round_proof.root);
+        challenges.push_back(transcript.sample());
+    }
+    transcript.absorb(proof.last_codeword);
+    const auto queries = transcript.sample_indices(parameters_.domain_length / 2, num_queries);
+
+    const BFieldElement two_inverse = BFieldElement::new_element(2).inverse();
+    BFieldElement offset = parameters_.domain_offset;
+    BFieldElement omega = BFieldElement::primitive_root_of_unity(parameters_.domain_length);
+    // The folding checks read the next round's revealed pairs, so every
+    // round's shape is checked first
+    for (size_t round = 0; round < num_rounds; round++) {
+        const size_t half = (parameters_.domain_length >> round) / 2;
+        const auto& round_proof = proof.rounds[round];
+        if (round_proof.revealed.size() != num_queries ||
+            round_proof.opening.indexed_leaves.size() != num_queries ||
+            round_proof.opening.tree_height != log2_exact(half)) {
+            return false;
+        }
+    }
+
+    for (size_t round = 0; round < num_rounds; round++) {
+        const size_t half = (parameters_.domain_length >> round) / 2;
+        const auto& round_proof = proof.rounds[round];
+        const auto& opening = round_proof.opening;
+
+        // The opened leaves are the revealed pairs at the queried positions
+        for (size_t k = 0; k < num_queries; k++) {
+            const auto& [leaf_index, leaf] = opening.indexed_leaves[k];
+            const auto& pair = round_proof.revealed[k];
+            if (leaf_index != queries[k] % half || leaf != leaf_digest(pair[0], pair[1])) {
+                return false;
+            }
+        }
+        if (!opening.verify(round_proof.root)) {
+            return false;
+        }
+
+        // Folding each pair gives a value of the next codeword
+        for (size_t k = 0; k < num_queries; k++) {
+            const size_t leaf_index = queries[k] % half;
+            const auto& pair = round_proof.revealed[k];
+            BFieldElement x = offset * omega.mod_pow(leaf_index);
+            BFieldElement folded = fold_pair(pair[0], pair[1], challenges[round] * x.inverse(), two_inverse);
+
+            BFieldElement expected;
+            if (round + 1 < num_rounds) {
+                const size_t next_half = half / 2;
+                expected = proof.rounds[round + 1].revealed[k][leaf_index < next_half ? 0 : 1];
+            } else {
+                expected = proof.last_codeword[leaf_index];
+            }
+            if (folded != expected) {
+                return false;
+            }
+        }
+
+        offset = offset * offset;
+        omega = omega * omega;
+    }
+    return true;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include "tip5xx/hash_cache.hpp"
+
+namespace tip5xx {
+
+HashCache::HashCache(size_t memory_budget, size_t num_shards) {
+    num_shards = std::max<size_t>(num_shards, 1);
+    const size_t set_size = WAYS * sizeof(Entry) + sizeof(uint8_t);
+    sets_per_shard_ = std::max<size_t>(memory_budget / (num_shards * set_size), 1);
+
+    shards_.reserve(num_shards);
+    for (size_t i = 0; i < num_shards; i++) {
+        auto shard = std::make_unique<Shard>();
+        shard->entries.resize(sets_per_shard_ * WAYS);
+        shard->recent.resize(sets_per_shard_);
+        shards_.push_back(std::move(shard));
+    }
+}
+
+HashCache::Key HashCache::make_key(const Digest& left, const Digest& right) {
+    Key key;
+    for (size_t i = 0; i < Digest::LEN; i++) {
+        key[i] = left[i].raw_u64();
+        key[Digest::LEN + i] = right[i].raw_u64();
+    }
+    return key;
+}
+
+uint64_t HashCache::key_hash(const Key& key) {
+    // Inputs may be structured (zeros, small counters), so mix every element
+    uint64_t h = 0x9E3779B97F4A7C15ULL;
+    for (uint64_t word : key) {
+        h ^= word;
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 31;
+    }
+    return h;
+}
+
+bool HashCache::lookup(const Key& key, Digest& value) {
+    const uint64_t h = key_hash(key);
+    Shard& shard = *shards_[h % shards_.size()];
+    const size_t set = (h / shards_.size()) % sets_per_shard_;
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (size_t way = 0; way < WAYS; way++) {
+        const Entry& entry = shard.entries[set * WAYS + way];
+        if (entry.valid && entry.key == key) {
+            value = entry.value;
+            shard.recent[set] = static_cast<uint8_t>(way);
+            shard.hits++;
+            return true;
+        }
+    }
+    shard.misses++;
+    return false;
+}
+
+void HashCache::insert(const Key& key, const Digest& value) {
+    const uint64_t h = key_hash(key);
+    Shard& shard = *shards_[h % shards_.size()];
+    const size_t set = (h / shards_.size()) % sets_per_shard_;
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size_t victim = WAYS;
+    for (size_t way = 0; way < WAYS && victim == WAYS; way++) {
+        const Entry& entry = shard.entries[set * WAYS + way];
+        if (!entry.valid || entry.key == key) {
+            victim = way;
+        }
+    }
+    if (victim == WAYS) {
+        victim = (shard.recent[set] + 1) % WAYS;
+    }
+    shard.entries[set * WAYS + victim] = {key, value, true};
+    shard.recent[set] = static_cast<uint8_t>(victim);
+}
+
+Digest HashCache::hash_pair(const Digest& left, const Digest& right) {
+    Key key = make_key(left, right);
+    Digest value;
+    if (!lookup(key, value)) {
+        value = Tip5::hash_pair(left, right);
+        insert(key, value);
+    }
+    return value;
+}
+
+std::array<BFieldElement, Digest::LEN> HashCache::hash_10(const std::array<BFieldElement, RATE>& input) {
+    Key key;
+    for (size_t i = 0; i < RATE; i++) {
+        key[i] = input[i].raw_u64();
+    }
+    Digest value;
+    if (!lookup(key, value)) {
+        value = Digest(Tip5::hash_10(input));
+        insert(key, value);
+    }
+    return value.values();
+}
+
+void HashCache::hash_pair_batch(const Digest* left, const Digest* right, Digest* out, size_t count) {
+    std::vector<size_t> missing;
+    std::vector<Digest> missing_left;
+    std::vector<Digest> missing_right;
+    for (size_t i = 0; i < count; i++) {
+        if (!lookup(make_key(left[i], right[i]), out[i])) {
+            missing.push_back(i);
+            missing_left.push_back(left[i]);
+            missing_right.push_back(right[i]);
+        }
+    }
+
+    std::vector<Digest> hashed(missing.size());
+    Tip5::hash_pair_batch(missing_left.data(), missing_right.data(), hashed.data(), missing.size());
+    for (size_t k = 0; k < missing.size(); k++) {
+        out[missing[k]] = hashed[k];
+        insert(make_key(missing_left[k], missing_right[k]), hashed[k]);
+    }
+}
+
+HashCache::Stats HashCache::stats() const {
+    Stats total;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total.hits += shard->hits;
+        total.misses += shard->misses;
+    }
+    return total;
+}
+
+void HashCache::reset_stats() {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->hits = 0;
+        shard->misses = 0;
+    }
+}
+
+void HashCache::clear() {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        for (auto& entry : shard->entries) {
+            entry.valid = false;
+        }
+    }
+}
+
+} // namespace tip5xx
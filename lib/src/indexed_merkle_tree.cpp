@@ -0,0 +1,133 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <unordered_set>
+#include "tip5xx/indexed_merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+std::vector<Digest> initial_leaves(size_t capacity) {
+    if (!MerkleTree::is_valid_num_leaves(capacity) || capacity < 2) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(capacity));
+    }
+    std::vector<Digest> leaves(capacity);
+    leaves[0] = IndexedMerkleLeaf{}.digest();
+    return leaves;
+}
+
+} // namespace
+
+Digest IndexedMerkleLeaf::digest() const {
+    return Tip5::hash_varlen({
+        BFieldElement::new_element(value),
+        BFieldElement::new_element(next_value),
+        BFieldElement::new_element(next_index)});
+}
+
+bool IndexedMerkleProof::verify_inclusion(const Digest& root, size_t tree_height) const {
+    return MerkleTree::verify_authentication_path(root, tree_height, leaf_index, leaf.digest(), authentication_path);
+}
+
+bool IndexedMerkleProof::verify_membership(const Digest& root, size_t tree_height, uint64_t value) const {
+    return value != 0 && leaf.value == value && verify_inclusion(root, tree_height);
+}
+
+bool IndexedMerkleProof::verify_non_membership(const Digest& root, size_t tree_height, uint64_t value) const {
+    bool in_gap = leaf.value < value && (leaf.next_value == 0 || value < leaf.next_value);
+    return in_gap && verify_inclusion(root, tree_height);
+}
+
+IndexedMerkleTree::IndexedMerkleTree(size_t capacity)
+    : tree_(MerkleTree::build(initial_leaves(capacity))), leaves_(1), index_of_{{0, 0}} {}
+
+const IndexedMerkleLeaf& IndexedMerkleTree::leaf(size_t leaf_index) const {
+    if (leaf_index >= leaves_.size()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    return leaves_[leaf_index];
+}
+
+size_t IndexedMerkleTree::low_leaf_index(uint64_t value) const {
+    // The largest value below `value`; 0 is always present
+    return std::prev(index_of_.lower_bound(value))->second;
+}
+
+size_t IndexedMerkleTree::insert(uint64_t value) {
+    return insert(std::vector<uint64_t>{value}).front();
+}
+
+std::vector<size_t> IndexedMerkleTree::insert(const std::vector<uint64_t>& values) {
+    std::unordered_set<uint64_t> batch;
+    for (uint64_t value : values) {
+        if (value == 0 || value > BFieldElement::MAX_VALUE) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidValue, std::to_string(value) + " is out of range");
+        }
+        if (contains(value) || !batch.insert(value).second) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidValue, std::to_string(value) + " is already in the set");
+        }
+    }
+    if (values.size() > capacity() - leaves_.size()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::TreeFull,
+                              std::to_string(values.size()) + " values for " +
+                              std::to_string(capacity() - leaves_.size()) + " free leaves");
+    }
+
+    // Splice every value into the list first; a low leaf shared by several
+    // new values is then rehashed once, together with all new leaves
+    std::vector<size_t> indices;
+    std::vector<size_t> changed;
+    indices.reserve(values.size());
+    for (uint64_t value : values) {
+        size_t low = low_leaf_index(value);
+        size_t index = leaves_.size();
+        leaves_.push_back({value, leaves_[low].next_value, leaves_[low].next_index});
+        leaves_[low].next_value = value;
+        leaves_[low].next_index = index;
+        index_of_.emplace(value, index);
+        indices.push_back(index);
+        changed.push_back(low);
+        changed.push_back(index);
+    }
+
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    std::vector<std::pair<size_t, Digest>> updates;
+    updates.reserve(changed.size());
+    for (size_t leaf_index : changed) {
+        updates.emplace_back(leaf_index, leaves_[leaf_index].digest());
+    }
+    tree_.update(updates);
+
+    return indices;
+}
+
+IndexedMerkleProof IndexedMerkleTree::prove(uint64_t value) const {
+    auto it = index_of_.find(value);
+    size_t leaf_index = it != index_of_.end() ? it->second : low_leaf_index(value);
+    return {leaf_index, leaves_[leaf_index], tree_.authentication_path(leaf_index)};
+}
+
+} // namespace tip5xx
@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include "tip5xx/low_degree_extension.hpp"
+
+namespace tip5xx {
+
+LowDegreeExtension::LowDegreeExtension(size_t trace_length, size_t expansion_factor,
+                                       const BFieldElement& extension_offset,
+                                       const BFieldElement& trace_offset)
+    : expansion_factor_(expansion_factor) {
+    if (!Ntt::is_valid_length(trace_length) || !Ntt::is_valid_length(expansion_factor) ||
+        !Ntt::is_valid_length(trace_length * expansion_factor)) {
+        throw NttError(NttError::ErrorType::InvalidLength,
+                       "trace length " + std::to_string(trace_length) +
+                       " with expansion factor " + std::to_string(expansion_factor));
+    }
+
+    // The inverse NTT on trace_offset * <omega_n> gives the coefficients
+    // of f scaled by trace_offset^i; the forward NTT on <omega_nb> of
+    // coefficients scaled by extension_offset^i gives the extension
+    const BFieldElement ratio = extension_offset * trace_offset.inverse();
+    weights_.resize(trace_length);
+    BFieldElement weight = BFieldElement::new_element(trace_length).inverse();
+    for (auto& w : weights_) {
+        w = weight;
+        weight *= ratio;
+    }
+}
+
+void LowDegreeExtension::extend_in_place(BFieldElement* values, ThreadPool* pool) const {
+    const size_t n = trace_length();
+    if (pool) {
+        Ntt::forward(values, n, *pool);
+    } else {
+        Ntt::forward(values, n);
+    }
+
+    // Coefficient i of the inverse transform is the forward one at (n - i) mod n
+    values[0] *= weights_[0];
+    for (size_t i = 1; i < n - i; i++) {
+        std::swap(values[i], values[n - i]);
+        values[i] *= weights_[i];
+        values[n - i] *= weights_[n - i];
+    }
+    if (n > 1) {
+        values[n / 2] *= weights_[n / 2];
+    }
+    std::fill(values + n, values + extension_length(), BFieldElement::zero());
+
+    if (pool) {
+        Ntt::forward(values, extension_length(), *pool);
+    } else {
+        Ntt::forward(values, extension_length());
+    }
+}
+
+void LowDegreeExtension::extend_column(const BFieldElement* trace_values, BFieldElement* extension_values) const {
+    std::copy_n(trace_values, trace_length(), extension_values);
+    extend_in_place(extension_values, nullptr);
+}
+
+std::vector<BFieldElement> LowDegreeExtension::extend(const std::vector<BFieldElement>& columns) const {
+    return extend(columns, ThreadPool::shared());
+}
+
+std::vector<BFieldElement> LowDegreeExtension::extend(const std::vector<BFieldElement>& columns,
+                                                      ThreadPool& pool) const {
+    const size_t n = trace_length();
+    if (columns.size() % n != 0) {
+        throw NttError(NttError::ErrorType::InvalidLength,
+                       std::to_string(columns.size()) + " values for columns of " + std::to_string(n));
+    }
+    const size_t num_columns = columns.size() / n;
+    std::vector<BFieldElement> extended(num_columns * extension_length());
+
+    if (num_columns < pool.num_threads()) {
+        for (size_t c = 0; c < num_columns; c++) {
+            BFieldElement* values = extended.data() + c * extension_length();
+            std::copy_n(columns.data() + c * n, n, values);
+            extend_in_place(values, &pool);
+        }
+        return extended;
+    }
+    pool.parallel_for(0, num_columns, [&](size_t c) {
+        extend_column(columns.data() + c * n, extended.data() + c * extension_length());
+    });
+    return extended;
+}
+
+} // namespace tip5xx
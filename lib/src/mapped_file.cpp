@@ -0,0 +1,252 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include <utility>
+#include "tip5xx/mapped_file.hpp"
+#include "tip5xx/merkle_tree_error.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tip5xx {
+
+namespace {
+
+[[noreturn]] void throw_io_error(const std::string& what, const std::string& path) {
+#ifdef _WIN32
+    std::string reason = "error " + std::to_string(GetLastError());
+#else
+    std::string reason = std::strerror(errno);
+#endif
+    throw MerkleTreeError(MerkleTreeError::ErrorType::Io, what + " '" + path + "': " + reason);
+}
+
+#ifndef _WIN32
+size_t page_size() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+#endif
+
+} // namespace
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(writable_, other.writable_);
+#ifdef _WIN32
+        std::swap(file_, other.file_);
+        std::swap(mapping_, other.mapping_);
+#else
+        std::swap(fd_, other.fd_);
+#endif
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+
+MappedFile MappedFile::open(const std::string& path, Mode mode) {
+    MappedFile file;
+    file.writable_ = mode == Mode::ReadWrite;
+
+    DWORD access = file.writable_ ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    HANDLE handle = CreateFileA(path.c_str(), access, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        throw_io_error("cannot open", path);
+    }
+    file.file_ = handle;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size)) {
+        throw_io_error("cannot stat", path);
+    }
+    file.size_ = static_cast<size_t>(size.QuadPart);
+    if (file.size_ == 0) {
+        return file;
+    }
+
+    HANDLE mapping = CreateFileMappingA(handle, nullptr, file.writable_ ? PAGE_READWRITE : PAGE_READONLY,
+                                        0, 0, nullptr);
+    if (mapping == nullptr) {
+        throw_io_error("cannot map", path);
+    }
+    file.mapping_ = mapping;
+
+    void* view = MapViewOfFile(mapping, file.writable_ ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        throw_io_error("cannot map", path);
+    }
+    file.data_ = static_cast<uint8_t*>(view);
+    return file;
+}
+
+MappedFile MappedFile::create(const std::string& path, size_t size) {
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        throw_io_error("cannot create", path);
+    }
+
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(size);
+    bool ok = SetFilePointerEx(handle, end, nullptr, FILE_BEGIN) && SetEndOfFile(handle);
+    CloseHandle(handle);
+    if (!ok) {
+        throw_io_error("cannot resize", path);
+    }
+
+    return open(path, Mode::ReadWrite);
+}
+
+void MappedFile::flush() {
+    if (data_ != nullptr && writable_) {
+        FlushViewOfFile(data_, 0);
+        FlushFileBuffers(static_cast<HANDLE>(file_));
+    }
+}
+
+void MappedFile::release(size_t, size_t) {
+    // Windows trims the working set of file mappings on its own
+}
+
+void MappedFile::close() {
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+    }
+    if (mapping_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mapping_));
+        mapping_ = nullptr;
+    }
+    if (file_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(file_));
+        file_ = nullptr;
+    }
+    size_ = 0;
+}
+
+#else
+
+MappedFile MappedFile::open(const std::string& path, Mode mode) {
+    MappedFile file;
+    file.writable_ = mode == Mode::ReadWrite;
+
+    file.fd_ = ::open(path.c_str(), file.writable_ ? O_RDWR : O_RDONLY);
+    if (file.fd_ < 0) {
+        throw_io_error("cannot open", path);
+    }
+
+    struct stat st;
+    if (fstat(file.fd_, &st) != 0) {
+        throw_io_error("cannot stat", path);
+    }
+    file.size_ = static_cast<size_t>(st.st_size);
+    if (file.size_ == 0) {
+        return file;
+    }
+
+    int protection = file.writable_ ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* data = mmap(nullptr, file.size_, protection, MAP_SHARED, file.fd_, 0);
+    if (data == MAP_FAILED) {
+        throw_io_error("cannot map", path);
+    }
+    file.data_ = static_cast<uint8_t*>(data);
+    return file;
+}
+
+MappedFile MappedFile::create(const std::string& path, size_t size) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw_io_error("cannot create", path);
+    }
+    bool ok = ftruncate(fd, static_cast<off_t>(size)) == 0;
+    ::close(fd);
+    if (!ok) {
+        throw_io_error("cannot resize", path);
+    }
+
+    return open(path, Mode::ReadWrite);
+}
+
+void MappedFile::flush() {
+    if (data_ != nullptr && writable_) {
+        msync(data_, size_, MS_SYNC);
+    }
+}
+
+void MappedFile::release(size_t offset, size_t length) {
+    if (data_ == nullptr || offset >= size_) {
+        return;
+    }
+
+    // madvise works on whole pages inside the range
+    size_t first = (offset + page_size() - 1) / page_size() * page_size();
+    size_t last = std::min(offset + length, size_) / page_size() * page_size();
+    if (first >= last) {
+        return;
+    }
+    if (writable_) {
+        msync(data_ + first, last - first, MS_SYNC);
+    }
+    madvise(data_ + first, last - first, MADV_DONTNEED);
+}
+
+void MappedFile::close() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+        data_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    size_ = 0;
+}
+
+#endif
+
+} // namespace tip5xx
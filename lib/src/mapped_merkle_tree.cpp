@@ -0,0 +1,201 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include <cstring>
+#include "tip5xx/mapped_merkle_tree.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+constexpr char MAGIC[8] = {'T', 'I', 'P', '5', 'M', 'K', 'T', '\0'};
+
+uint64_t load_u64(const uint8_t* bytes) {
+    uint64_t value = 0;
+    for (size_t i = 8; i-- > 0;) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+void store_u64(uint8_t* bytes, uint64_t value) {
+    for (size_t i = 0; i < 8; i++) {
+        bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+// Throws MerkleTreeError::InvalidFile on non-canonical elements
+Digest load_digest(const uint8_t* bytes) {
+    std::array<uint8_t, Digest::BYTES> digest_bytes;
+    std::memcpy(digest_bytes.data(), bytes, Digest::BYTES);
+    auto digest = Digest::from_bytes(digest_bytes);
+    if (!digest) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile, "non-canonical digest");
+    }
+    return *digest;
+}
+
+void store_digest(uint8_t* bytes, const Digest& digest) {
+    auto digest_bytes = digest.to_bytes();
+    std::memcpy(bytes, digest_bytes.data(), Digest::BYTES);
+}
+
+size_t log2_exact(uint64_t n) {
+    size_t log = 0;
+    while ((n >> log) > 1) {
+        log++;
+    }
+    return log;
+}
+
+} // namespace
+
+uint64_t MappedMerkleTree::file_size(uint64_t num_leaves) {
+    return HEADER_SIZE + Digest::BYTES * (2 * num_leaves - 1);
+}
+
+uint64_t MappedMerkleTree::level_offset(uint64_t num_leaves, size_t level) {
+    return HEADER_SIZE + Digest::BYTES * (2 * num_leaves - 2 * (num_leaves >> level));
+}
+
+void MappedMerkleTree::build(const std::string& leaves_path, const std::string& tree_path) {
+    build(leaves_path, tree_path, ThreadPool::shared());
+}
+
+void MappedMerkleTree::build(const std::string& leaves_path, const std::string& tree_path, ThreadPool& pool,
+                             size_t tile_height) {
+    const size_t leaves_size = MappedFile::open(leaves_path).size();
+    if (leaves_size % Digest::BYTES != 0) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile,
+                              "size of '" + leaves_path + "' is not a multiple of " + std::to_string(Digest::BYTES));
+    }
+    build(leaves_path, 0, leaves_size / Digest::BYTES, tree_path, pool, tile_height);
+}
+
+void MappedMerkleTree::build(const std::string& leaves_path, uint64_t first_leaf, uint64_t num_leaves,
+                             const std::string& tree_path, ThreadPool& pool, size_t tile_height) {
+    MappedFile leaves_file = MappedFile::open(leaves_path);
+    const uint64_t leaves_in_file = leaves_file.size() / Digest::BYTES;
+    if (first_leaf > leaves_in_file || num_leaves > leaves_in_file - first_leaf) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile,
+                              "'" + leaves_path + "' has no leaves [" + std::to_string(first_leaf) + ", " +
+                              std::to_string(first_leaf + num_leaves) + ")");
+    }
+    if (!MerkleTree::is_valid_num_leaves(num_leaves)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(num_leaves));
+    }
+    const size_t height = log2_exact(num_leaves);
+
+    MappedFile tree_file = MappedFile::create(tree_path, file_size(num_leaves));
+    uint8_t* header = tree_file.data();
+    std::memcpy(header, MAGIC, sizeof(MAGIC));
+    store_u64(header + 8, VERSION);
+    store_u64(header + 16, num_leaves);
+
+    // Build tiles of up to tile_height levels at a time. The first
+    // pass reads the leaves file; later passes read the level written by
+    // the previous pass, so only one tile is ever held in memory.
+    std::vector<Digest> tile_leaves;
+    size_t level = 0;
+    do {
+        const size_t pass_height = std::min(std::max<size_t>(tile_height, 1), height - level);
+        const uint64_t tile_width = uint64_t{1} << pass_height;
+        const uint64_t num_tiles = (num_leaves >> level) >> pass_height;
+
+        MappedFile& source = level == 0 ? leaves_file : tree_file;
+        const uint64_t source_offset = level == 0 ? first_leaf * Digest::BYTES : level_offset(num_leaves, level);
+
+        tile_leaves.resize(tile_width);
+        for (uint64_t tile = 0; tile < num_tiles; tile++) {
+            uint64_t tile_offset = source_offset + tile * tile_width * Digest::BYTES;
+            for (uint64_t i = 0; i < tile_width; i++) {
+                tile_leaves[i] = load_digest(source.data() + tile_offset + i * Digest::BYTES);
+            }
+            source.release(tile_offset, tile_width * Digest::BYTES);
+
+            auto subtree = MerkleTree::build(tile_leaves, pool);
+
+            // The tile's bottom level is already in the tree file after the first pass
+            for (size_t k = level == 0 ? 0 : 1; k <= pass_height; k++) {
+                uint64_t width = tile_width >> k;
+                uint64_t offset = level_offset(num_leaves, level + k) + tile * width * Digest::BYTES;
+                for (uint64_t i = 0; i < width; i++) {
+                    store_digest(tree_file.data() + offset + i * Digest::BYTES, subtree.node(width + i));
+                }
+                tree_file.release(offset, width * Digest::BYTES);
+            }
+        }
+        level += pass_height;
+    } while (level < height);
+
+    tree_file.flush();
+}
+
+MappedMerkleTree MappedMerkleTree::open(const std::string& tree_path) {
+    MappedFile file = MappedFile::open(tree_path);
+    if (file.size() < HEADER_SIZE || std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile, "'" + tree_path + "' has no tree header");
+    }
+    if (load_u64(file.data() + 8) != VERSION) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile, "unsupported version in '" + tree_path + "'");
+    }
+
+    uint64_t num_leaves = load_u64(file.data() + 16);
+    if (!MerkleTree::is_valid_num_leaves(num_leaves) || num_leaves > (uint64_t{1} << 58) ||
+        file.size() != file_size(num_leaves)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile, "size mismatch in '" + tree_path + "'");
+    }
+
+    return MappedMerkleTree(std::move(file), num_leaves, log2_exact(num_leaves));
+}
+
+Digest MappedMerkleTree::node(size_t level, uint64_t index) const {
+    if (level > height_ || index >= (num_leaves_ >> level)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "node " + std::to_string(index) + " at level " + std::to_string(level));
+    }
+    return load_digest(file_.data() + level_offset(num_leaves_, level) + index * Digest::BYTES);
+}
+
+Digest MappedMerkleTree::leaf(uint64_t leaf_index) const {
+    if (leaf_index >= num_leaves_) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    return node(0, leaf_index);
+}
+
+std::vector<Digest> MappedMerkleTree::authentication_path(uint64_t leaf_index) const {
+    if (leaf_index >= num_leaves_) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+
+    std::vector<Digest> path;
+    path.reserve(height_);
+    for (size_t level = 0; level < height_; level++) {
+        path.push_back(node(level, (leaf_index >> level) ^ 1));
+    }
+    return path;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include "tip5xx/merkle_batch_verifier.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+std::vector<bool> MerkleBatchVerifier::verify(const std::vector<MerkleInclusionClaim>& claims) {
+    std::vector<bool> result(claims.size(), false);
+
+    // Claims that are well-formed take part in the level-by-level walk
+    std::vector<size_t> active;
+    std::vector<Digest> acc(claims.size());
+    size_t max_height = 0;
+    for (size_t i = 0; i < claims.size(); i++) {
+        const auto& claim = claims[i];
+        if (claim.tree_height >= 64 || claim.authentication_path.size() != claim.tree_height) {
+            continue;
+        }
+        if (claim.leaf_index >= (uint64_t{1} << claim.tree_height)) {
+            continue;
+        }
+        acc[i] = claim.leaf;
+        active.push_back(i);
+        max_height = std::max(max_height, claim.tree_height);
+    }
+
+    std::vector<size_t> lanes;
+    std::vector<Digest> left, right, parent;
+    for (size_t level = 0; level < max_height; level++) {
+        lanes.clear();
+        left.clear();
+        right.clear();
+        for (size_t i : active) {
+            const auto& claim = claims[i];
+            if (level >= claim.tree_height) {
+                continue;
+            }
+            const Digest& sibling = claim.authentication_path[level];
+            bool is_right_child = (claim.leaf_index >> level) & 1;
+            left.push_back(is_right_child ? sibling : acc[i]);
+            right.push_back(is_right_child ? acc[i] : sibling);
+            lanes.push_back(i);
+        }
+
+        parent.resize(lanes.size());
+        Tip5::hash_pair_batch(left.data(), right.data(), parent.data(), lanes.size());
+        for (size_t j = 0; j < lanes.size(); j++) {
+            acc[lanes[j]] = parent[j];
+        }
+    }
+
+    for (size_t i : active) {
+        result[i] = acc[i] == claims[i].root;
+    }
+    return result;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <array>
+#include "tip5xx/merkle_cap.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+bool is_valid_cap(size_t tree_height, size_t cap_size) {
+    return tree_height < 64 && MerkleTree::is_valid_num_leaves(cap_size) && cap_size <= (uint64_t{1} << tree_height);
+}
+
+void check_cap_height(const MerkleTree& tree, size_t cap_height) {
+    if (cap_height > tree.height()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "cap height " + std::to_string(cap_height) + " above tree height " +
+                              std::to_string(tree.height()));
+    }
+}
+
+} // namespace
+
+MerkleCap::MerkleCap(size_t tree_height, std::vector<Digest> digests)
+    : tree_height_(tree_height), digests_(std::move(digests)) {
+    if (!is_valid_cap(tree_height_, digests_.size())) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "cap of " + std::to_string(digests_.size()) + " digests for tree height " +
+                              std::to_string(tree_height_));
+    }
+}
+
+MerkleCap MerkleCap::from_tree(const MerkleTree& tree, size_t cap_height) {
+    check_cap_height(tree, cap_height);
+
+    // Depth cap_height holds the nodes [2^cap_height, 2^(cap_height + 1))
+    size_t first = size_t{1} << cap_height;
+    const auto& nodes = tree.nodes();
+    return MerkleCap(tree.height(), std::vector<Digest>(nodes.begin() + first, nodes.begin() + 2 * first));
+}
+
+std::vector<Digest> MerkleCap::authentication_path(const MerkleTree& tree, size_t cap_height, size_t leaf_index) {
+    check_cap_height(tree, cap_height);
+    auto path = tree.authentication_path(leaf_index);
+    path.resize(path.size() - cap_height);
+    return path;
+}
+
+size_t MerkleCap::cap_height() const {
+    size_t height = 0;
+    while ((digests_.size() >> height) > 1) {
+        height++;
+    }
+    return height;
+}
+
+Digest MerkleCap::root() const {
+    std::vector<Digest> level = digests_;
+    while (level.size() > 1) {
+        for (size_t i = 0; i < level.size() / 2; i++) {
+            level[i] = Tip5::hash_pair(level[2 * i], level[2 * i + 1]);
+        }
+        level.resize(level.size() / 2);
+    }
+    return level[0];
+}
+
+bool MerkleCap::verify(size_t leaf_index, const Digest& leaf, const std::vector<Digest>& authentication_path) const {
+    const size_t path_length = tree_height_ - cap_height();
+    if (authentication_path.size() != path_length || leaf_index >= (uint64_t{1} << tree_height_)) {
+        return false;
+    }
+
+    uint64_t node_index = leaf_index;
+    Digest acc = leaf;
+    for (const auto& sibling : authentication_path) {
+        acc = (node_index & 1) ? Tip5::hash_pair(sibling, acc) : Tip5::hash_pair(acc, sibling);
+        node_index /= 2;
+    }
+    // What is left of the index is the position within the cap
+    return acc == digests_[node_index];
+}
+
+std::vector<uint8_t> MerkleCap::to_bytes() const {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(sizeof(uint64_t) + digests_.size() * Digest::BYTES);
+    for (size_t i = 0; i < sizeof(uint64_t); i++) {
+        bytes.push_back(static_cast<uint8_t>(static_cast<uint64_t>(tree_height_) >> (8 * i)));
+    }
+    for (const auto& digest : digests_) {
+        auto digest_bytes = digest.to_bytes();
+        bytes.insert(bytes.end(), digest_bytes.begin(), digest_bytes.end());
+    }
+    return bytes;
+}
+
+std::optional<MerkleCap> MerkleCap::from_bytes(const std::vector<uint8_t>& bytes) {
+    if (bytes.size() < sizeof(uint64_t) || (bytes.size() - sizeof(uint64_t)) % Digest::BYTES != 0) {
+        return std::nullopt;
+    }
+
+    uint64_t tree_height = 0;
+    for (size_t i = sizeof(uint64_t); i-- > 0;) {
+        tree_height = (tree_height << 8) | bytes[i];
+    }
+    size_t cap_size = (bytes.size() - sizeof(uint64_t)) / Digest::BYTES;
+    if (!is_valid_cap(tree_height, cap_size)) {
+        return std::nullopt;
+    }
+
+    std::vector<Digest> digests;
+    digests.reserve(cap_size);
+    for (size_t offset = sizeof(uint64_t); offset < bytes.size(); offset += Digest::BYTES) {
+        std::array<uint8_t, Digest::BYTES> digest_bytes;
+        std::copy_n(bytes.begin() + offset, Digest::BYTES, digest_bytes.begin());
+        auto digest = Digest::from_bytes(digest_bytes);
+        if (!digest) {
+            return std::nullopt;
+        }
+        digests.push_back(*digest);
+    }
+
+    return MerkleCap(tree_height, std::move(digests));
+}
+
+} // namespace tip5xx
@@ -0,0 +1,203 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <array>
+#include "tip5xx/merkle_diff.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+void append_u64(std::vector<uint8_t>& bytes, uint64_t value) {
+    for (size_t i = 0; i < sizeof(uint64_t); i++) {
+        bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint64_t read_u64(const std::vector<uint8_t>& bytes, size_t offset) {
+    uint64_t value = 0;
+    for (size_t i = sizeof(uint64_t); i-- > 0;) {
+        value = (value << 8) | bytes[offset + i];
+    }
+    return value;
+}
+
+} // namespace
+
+std::vector<LeafRange> MerkleDiff::diff(const MerkleTree& a, const MerkleTree& b) {
+    if (a.num_leaves() != b.num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "trees of " + std::to_string(a.num_leaves()) + " and " + std::to_string(b.num_leaves()) +
+                              " leaves");
+    }
+
+    // Depth-first with the left child on top, so leaves come out in order
+    const size_t num_leaves = a.num_leaves();
+    std::vector<size_t> leaf_indices;
+    std::vector<size_t> pending = {MerkleTree::ROOT_INDEX};
+    while (!pending.empty()) {
+        size_t node_index = pending.back();
+        pending.pop_back();
+        if (a.node(node_index) == b.node(node_index)) {
+            continue;
+        }
+        if (node_index >= num_leaves) {
+            leaf_indices.push_back(node_index - num_leaves);
+        } else {
+            pending.push_back(2 * node_index + 1);
+            pending.push_back(2 * node_index);
+        }
+    }
+    return to_ranges(leaf_indices);
+}
+
+std::vector<LeafRange> MerkleDiff::to_ranges(const std::vector<size_t>& leaf_indices) {
+    std::vector<LeafRange> ranges;
+    for (size_t leaf_index : leaf_indices) {
+        if (!ranges.empty() && ranges.back().end == leaf_index) {
+            ranges.back().end++;
+        } else {
+            ranges.push_back({leaf_index, leaf_index + 1});
+        }
+    }
+    return ranges;
+}
+
+std::vector<uint8_t> MerkleSyncRequest::to_bytes() const {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(sizeof(uint64_t) * (2 + node_indices.size()));
+    append_u64(bytes, num_leaves);
+    append_u64(bytes, node_indices.size());
+    for (uint64_t node_index : node_indices) {
+        append_u64(bytes, node_index);
+    }
+    return bytes;
+}
+
+std::optional<MerkleSyncRequest> MerkleSyncRequest::from_bytes(const std::vector<uint8_t>& bytes) {
+    if (bytes.size() < 2 * sizeof(uint64_t) || bytes.size() % sizeof(uint64_t) != 0) {
+        return std::nullopt;
+    }
+    MerkleSyncRequest request;
+    request.num_leaves = read_u64(bytes, 0);
+    uint64_t count = read_u64(bytes, sizeof(uint64_t));
+    if (count != bytes.size() / sizeof(uint64_t) - 2) {
+        return std::nullopt;
+    }
+    request.node_indices.reserve(count);
+    for (size_t offset = 2 * sizeof(uint64_t); offset < bytes.size(); offset += sizeof(uint64_t)) {
+        request.node_indices.push_back(read_u64(bytes, offset));
+    }
+    return request;
+}
+
+std::vector<uint8_t> MerkleSyncResponse::to_bytes() const {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(sizeof(uint64_t) + digests.size() * Digest::BYTES);
+    append_u64(bytes, digests.size());
+    for (const auto& digest : digests) {
+        auto digest_bytes = digest.to_bytes();
+        bytes.insert(bytes.end(), digest_bytes.begin(), digest_bytes.end());
+    }
+    return bytes;
+}
+
+std::optional<MerkleSyncResponse> MerkleSyncResponse::from_bytes(const std::vector<uint8_t>& bytes) {
+    if (bytes.size() < sizeof(uint64_t) || (bytes.size() - sizeof(uint64_t)) % Digest::BYTES != 0 ||
+        read_u64(bytes, 0) != (bytes.size() - sizeof(uint64_t)) / Digest::BYTES) {
+        return std::nullopt;
+    }
+    MerkleSyncResponse response;
+    for (size_t offset = sizeof(uint64_t); offset < bytes.size(); offset += Digest::BYTES) {
+        std::array<uint8_t, Digest::BYTES> digest_bytes;
+        std::copy_n(bytes.begin() + offset, Digest::BYTES, digest_bytes.begin());
+        auto digest = Digest::from_bytes(digest_bytes);
+        if (!digest) {
+            return std::nullopt;
+        }
+        response.digests.push_back(*digest);
+    }
+    return response;
+}
+
+MerkleSync::MerkleSync(const MerkleTree& local) : local_(local) {
+    request_.num_leaves = local.num_leaves();
+    request_.node_indices = {MerkleTree::ROOT_INDEX};
+}
+
+MerkleSyncResponse MerkleSync::respond(const MerkleTree& tree, const MerkleSyncRequest& request) {
+    if (request.num_leaves != tree.num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "request for " + std::to_string(request.num_leaves) + " leaves to a tree of " +
+                              std::to_string(tree.num_leaves()));
+    }
+
+    MerkleSyncResponse response;
+    response.digests.reserve(request.node_indices.size());
+    for (uint64_t node_index : request.node_indices) {
+        if (node_index == 0 || node_index >= 2 * tree.num_leaves()) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                                  "node " + std::to_string(node_index) + " requested from a tree of " +
+                                  std::to_string(tree.num_leaves()) + " leaves");
+        }
+        response.digests.push_back(tree.node(node_index));
+    }
+    return response;
+}
+
+void MerkleSync::receive(const MerkleSyncResponse& response) {
+    if (response.digests.size() != request_.node_indices.size()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "response of " + std::to_string(response.digests.size()) + " digests to a request for " +
+                              std::to_string(request_.node_indices.size()) + " nodes");
+    }
+
+    // All requested nodes are on one level, in ascending order, so the
+    // children asked for next are too
+    const size_t num_leaves = local_.num_leaves();
+    std::vector<uint64_t> next;
+    for (size_t i = 0; i < response.digests.size(); i++) {
+        uint64_t node_index = request_.node_indices[i];
+        if (response.digests[i] == local_.node(node_index)) {
+            continue;
+        }
+        if (node_index >= num_leaves) {
+            differing_leaves_.emplace_back(node_index - num_leaves, response.digests[i]);
+        } else {
+            next.push_back(2 * node_index);
+            next.push_back(2 * node_index + 1);
+        }
+    }
+    request_.node_indices = std::move(next);
+}
+
+std::vector<LeafRange> MerkleSync::differing_leaf_ranges() const {
+    std::vector<size_t> leaf_indices;
+    leaf_indices.reserve(differing_leaves_.size());
+    for (const auto& [leaf_index, leaf] : differing_leaves_) {
+        leaf_indices.push_back(leaf_index);
+    }
+    return MerkleDiff::to_ranges(leaf_indices);
+}
+
+} // namespace tip5xx
@@ -0,0 +1,137 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include "tip5xx/merkle_multi_proof.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+std::vector<size_t> MerkleMultiProof::authentication_structure_node_indices(
+    size_t num_leaves,
+    const std::vector<size_t>& leaf_indices) {
+
+    if (!MerkleTree::is_valid_num_leaves(num_leaves)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(num_leaves));
+    }
+
+    std::vector<size_t> level;
+    level.reserve(leaf_indices.size());
+    for (size_t leaf_index : leaf_indices) {
+        if (leaf_index >= num_leaves) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+        }
+        level.push_back(num_leaves + leaf_index);
+    }
+    std::sort(level.begin(), level.end());
+    level.erase(std::unique(level.begin(), level.end()), level.end());
+
+    // Walk up level by level; a sibling is only needed if it is not itself
+    // an ancestor of an opened leaf, i.e. not present in the current level
+    std::vector<size_t> node_indices;
+    std::vector<size_t> parents;
+    while (!level.empty() && level.front() > MerkleTree::ROOT_INDEX) {
+        parents.clear();
+        for (size_t i = 0; i < level.size(); i++) {
+            size_t node = level[i];
+            if (node % 2 == 0 && i + 1 < level.size() && level[i + 1] == node + 1) {
+                i++;
+            } else {
+                node_indices.push_back(node ^ 1);
+            }
+            parents.push_back(node / 2);
+        }
+        std::swap(level, parents);
+    }
+
+    return node_indices;
+}
+
+MerkleMultiProof MerkleMultiProof::generate(const MerkleTree& tree, const std::vector<size_t>& leaf_indices) {
+    MerkleMultiProof proof;
+    proof.tree_height = tree.height();
+
+    for (size_t node_index : authentication_structure_node_indices(tree.num_leaves(), leaf_indices)) {
+        proof.authentication_structure.push_back(tree.node(node_index));
+    }
+
+    proof.indexed_leaves.reserve(leaf_indices.size());
+    for (size_t leaf_index : leaf_indices) {
+        proof.indexed_leaves.emplace_back(leaf_index, tree.leaf(leaf_index));
+    }
+
+    return proof;
+}
+
+bool MerkleMultiProof::verify(const Digest& root) const {
+    if (tree_height >= 64 || indexed_leaves.empty()) {
+        return false;
+    }
+    const uint64_t num_leaves = uint64_t{1} << tree_height;
+
+    std::vector<std::pair<uint64_t, Digest>> level;
+    level.reserve(indexed_leaves.size());
+    for (const auto& [leaf_index, leaf] : indexed_leaves) {
+        if (leaf_index >= num_leaves) {
+            return false;
+        }
+        level.emplace_back(num_leaves + leaf_index, leaf);
+    }
+    std::sort(level.begin(), level.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    // The same leaf may be opened more than once, but never with different digests
+    for (size_t i = 1; i < level.size(); i++) {
+        if (level[i].first == level[i - 1].first && level[i].second != level[i - 1].second) {
+            return false;
+        }
+    }
+    level.erase(std::unique(level.begin(), level.end(),
+                            [](const auto& a, const auto& b) { return a.first == b.first; }),
+                level.end());
+
+    auto next_sibling = authentication_structure.begin();
+    std::vector<std::pair<uint64_t, Digest>> parents;
+    while (level.front().first > MerkleTree::ROOT_INDEX) {
+        parents.clear();
+        for (size_t i = 0; i < level.size(); i++) {
+            uint64_t node = level[i].first;
+            const Digest& digest = level[i].second;
+            if (node % 2 == 0 && i + 1 < level.size() && level[i + 1].first == node + 1) {
+                parents.emplace_back(node / 2, Tip5::hash_pair(digest, level[i + 1].second));
+                i++;
+                continue;
+            }
+            if (next_sibling == authentication_structure.end()) {
+                return false;
+            }
+            const Digest& sibling = *next_sibling++;
+            parents.emplace_back(node / 2, node % 2 == 0 ? Tip5::hash_pair(digest, sibling)
+                                                         : Tip5::hash_pair(sibling, digest));
+        }
+        std::swap(level, parents);
+    }
+
+    return next_sibling == authentication_structure.end() && level.front().second == root;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/merkle_root_builder.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+void MerkleRootBuilder::push(const Digest& leaf) {
+    // Each trailing one bit of the count is a pending subtree of the same
+    // height as the one being carried
+    Digest carry = leaf;
+    for (uint64_t count = num_leaves_; (count & 1) != 0; count >>= 1) {
+        carry = Tip5::hash_pair(pending_.back(), carry);
+        pending_.pop_back();
+    }
+    pending_.push_back(carry);
+    num_leaves_++;
+}
+
+void MerkleRootBuilder::push(const Digest* leaves, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        push(leaves[i]);
+    }
+}
+
+Digest MerkleRootBuilder::root() const {
+    if (num_leaves_ > SIZE_MAX || !MerkleTree::is_valid_num_leaves(static_cast<size_t>(num_leaves_))) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(num_leaves_));
+    }
+    return pending_.front();
+}
+
+} // namespace tip5xx
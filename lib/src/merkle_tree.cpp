@@ -0,0 +1,196 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Number of nodes of a wide top level that are hashed by one task
+constexpr size_t TOP_LEVEL_CHUNK = 256;
+
+size_t log2_exact(size_t n) {
+    size_t log = 0;
+    while ((n >> log) > 1) {
+        log++;
+    }
+    return log;
+}
+
+} // namespace
+
+MerkleTree MerkleTree::build(const std::vector<Digest>& leaves) {
+    return build(leaves.data(), leaves.size(), ThreadPool::shared());
+}
+
+MerkleTree MerkleTree::build(const std::vector<Digest>& leaves, ThreadPool& pool) {
+    return build(leaves.data(), leaves.size(), pool);
+}
+
+MerkleTree MerkleTree::build(const Digest* leaves, size_t num_leaves, ThreadPool& pool) {
+    if (!is_valid_num_leaves(num_leaves)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(num_leaves));
+    }
+
+    std::vector<Digest> nodes(2 * num_leaves);
+    std::copy(leaves, leaves + num_leaves, nodes.begin() + num_leaves);
+    Digest* data = nodes.data();
+
+    const size_t tree_height = log2_exact(num_leaves);
+    const size_t tile_height = std::min(tree_height, TILE_HEIGHT);
+    const size_t num_tiles = num_leaves >> tile_height;
+
+    // Each tile is a complete subtree whose nodes are hashed bottom-up
+    // while they are still in cache; tiles are independent of each other
+    pool.parallel_for(0, num_tiles, [data, num_leaves, tile_height](size_t tile) {
+        for (size_t level = 1; level <= tile_height; level++) {
+            size_t tile_width = size_t{1} << (tile_height - level);
+            size_t first = (num_leaves >> level) + tile * tile_width;
+            for (size_t i = first; i < first + tile_width; i++) {
+                data[i] = Tip5::hash_pair(data[2 * i], data[2 * i + 1]);
+            }
+        }
+    });
+
+    // The levels above the tile roots, one level at a time
+    for (size_t width = num_tiles / 2; width >= 1; width /= 2) {
+        size_t num_chunks = (width + TOP_LEVEL_CHUNK - 1) / TOP_LEVEL_CHUNK;
+        auto hash_chunk = [data, width](size_t chunk) {
+            size_t first = width + chunk * TOP_LEVEL_CHUNK;
+            size_t last = std::min(first + TOP_LEVEL_CHUNK, 2 * width);
+            for (size_t i = first; i < last; i++) {
+                data[i] = Tip5::hash_pair(data[2 * i], data[2 * i + 1]);
+            }
+        };
+        if (num_chunks > 1) {
+            pool.parallel_for(0, num_chunks, hash_chunk);
+        } else {
+            hash_chunk(0);
+        }
+    }
+
+    return MerkleTree(std::move(nodes));
+}
+
+size_t MerkleTree::height() const {
+    return log2_exact(num_leaves());
+}
+
+const Digest& MerkleTree::leaf(size_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    return nodes_[num_leaves() + leaf_index];
+}
+
+void MerkleTree::update(const std::vector<std::pair<size_t, Digest>>& leaf_updates) {
+    const size_t n = num_leaves();
+    for (const auto& [leaf_index, digest] : leaf_updates) {
+        if (leaf_index >= n) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+        }
+    }
+
+    std::vector<size_t> dirty;
+    dirty.reserve(leaf_updates.size());
+    for (const auto& [leaf_index, digest] : leaf_updates) {
+        nodes_[n + leaf_index] = digest;
+        dirty.push_back(n + leaf_index);
+    }
+    std::sort(dirty.begin(), dirty.end());
+
+    std::vector<Digest> left;
+    std::vector<Digest> right;
+    std::vector<Digest> hashed;
+    while (!dirty.empty() && dirty.front() > ROOT_INDEX) {
+        // Parents of a sorted level are sorted, so duplicates are adjacent
+        size_t num_parents = 0;
+        for (size_t node_index : dirty) {
+            size_t parent = node_index / 2;
+            if (num_parents == 0 || dirty[num_parents - 1] != parent) {
+                dirty[num_parents++] = parent;
+            }
+        }
+        dirty.resize(num_parents);
+
+        left.resize(num_parents);
+        right.resize(num_parents);
+        hashed.resize(num_parents);
+        for (size_t i = 0; i < num_parents; i++) {
+            left[i] = nodes_[2 * dirty[i]];
+            right[i] = nodes_[2 * dirty[i] + 1];
+        }
+        Tip5::hash_pair_batch(left.data(), right.data(), hashed.data(), num_parents);
+        for (size_t i = 0; i < num_parents; i++) {
+            nodes_[dirty[i]] = hashed[i];
+        }
+    }
+}
+
+std::vector<Digest> MerkleTree::authentication_path(size_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+
+    std::vector<Digest> path(height());
+    authentication_path(leaf_index, path.data());
+    return path;
+}
+
+void MerkleTree::authentication_path(size_t leaf_index, Digest* path) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+
+    for (size_t node_index = num_leaves() + leaf_index; node_index > ROOT_INDEX; node_index /= 2) {
+        *path++ = nodes_[node_index ^ 1];
+    }
+}
+
+bool MerkleTree::verify_authentication_path(
+    const Digest& root,
+    size_t tree_height,
+    size_t leaf_index,
+    const Digest& leaf,
+    const std::vector<Digest>& authentication_path) {
+
+    if (tree_height >= 64 || authentication_path.size() != tree_height) {
+        return false;
+    }
+    if (leaf_index >= (uint64_t{1} << tree_height)) {
+        return false;
+    }
+
+    uint64_t node_index = (uint64_t{1} << tree_height) + leaf_index;
+    Digest acc = leaf;
+    for (const auto& sibling : authentication_path) {
+        acc = (node_index & 1) ? Tip5::hash_pair(sibling, acc) : Tip5::hash_pair(acc, sibling);
+        node_index /= 2;
+    }
+    return acc == root;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <sstream>
+#include "tip5xx/merkle_tree_error.hpp"
+
+namespace tip5xx {
+
+std::string MerkleTreeError::build_message(ErrorType type, const std::string& detail) {
+    std::ostringstream oss;
+    switch (type) {
+        case ErrorType::IncorrectNumberOfLeaves:
+            oss << "number of leaves must be a non-zero power of two, but got " << detail;
+            break;
+        case ErrorType::LeafIndexOutOfBounds:
+            oss << "leaf index out of bounds: " << detail;
+            break;
+        case ErrorType::IncorrectNumberOfPeaks:
+            oss << "number of peaks does not match the number of leaves: " << detail;
+            break;
+        case ErrorType::InvalidFile:
+            oss << "invalid Merkle tree file: " << detail;
+            break;
+        case ErrorType::Io:
+            oss << "I/O error: " << detail;
+            break;
+        case ErrorType::UnknownVersion:
+            oss << "unknown or released tree version: " << detail;
+            break;
+        case ErrorType::InvalidValue:
+            oss << "invalid value: " << detail;
+            break;
+        case ErrorType::TreeFull:
+            oss << "tree is full: " << detail;
+            break;
+        case ErrorType::UncommittedChanges:
+            oss << "commit pending changes first: " << detail;
+            break;
+        case ErrorType::SlotOccupied:
+            oss << "slot is held by another key: " << detail;
+            break;
+        case ErrorType::InvalidArgument:
+            oss << "invalid argument: " << detail;
+            break;
+    }
+    return oss.str();
+}
+
+} // namespace tip5xx
@@ -0,0 +1,233 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/mmr.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+struct MountainLocation {
+    size_t peak_index;
+    size_t height;
+    uint64_t local_index;
+};
+
+// Find the mountain holding a leaf; mountains are ordered highest first
+MountainLocation locate_leaf(uint64_t num_leaves, uint64_t leaf_index) {
+    uint64_t offset = 0;
+    size_t peak_index = 0;
+    for (size_t height = 64; height-- > 0;) {
+        uint64_t size = uint64_t{1} << height;
+        if ((num_leaves & size) == 0) {
+            continue;
+        }
+        if (leaf_index < offset + size) {
+            return {peak_index, height, leaf_index - offset};
+        }
+        offset += size;
+        peak_index++;
+    }
+    throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+}
+
+size_t num_trailing_ones(uint64_t x) {
+    size_t count = 0;
+    while (x & 1) {
+        x >>= 1;
+        count++;
+    }
+    return count;
+}
+
+size_t num_ones(uint64_t x) {
+    size_t count = 0;
+    for (; x != 0; x &= x - 1) {
+        count++;
+    }
+    return count;
+}
+
+} // namespace
+
+bool MmrMembershipProof::verify(const Digest& leaf, const std::vector<Digest>& peaks, uint64_t num_leaves) const {
+    if (leaf_index >= num_leaves || peaks.size() != num_ones(num_leaves)) {
+        return false;
+    }
+    auto location = locate_leaf(num_leaves, leaf_index);
+    return MerkleTree::verify_authentication_path(
+        peaks[location.peak_index], location.height, location.local_index, leaf, authentication_path);
+}
+
+void MmrMembershipProof::update_from_append(
+    uint64_t old_num_leaves,
+    const Digest& new_leaf,
+    const std::vector<Digest>& old_peaks) {
+
+    // Appending merges the new leaf with the lowest `merges` peaks, of heights 0, 1, ...
+    size_t merges = num_trailing_ones(old_num_leaves);
+    auto location = locate_leaf(old_num_leaves, leaf_index);
+    if (location.height >= merges) {
+        return;
+    }
+
+    // Lowest peaks are at the back; the one of height h is old_peaks[size - 1 - h]
+    Digest acc = new_leaf;
+    for (size_t height = 0; height < location.height; height++) {
+        acc = Tip5::hash_pair(old_peaks[old_peaks.size() - 1 - height], acc);
+    }
+
+    // The leaf's mountain is the left child of the next merge and a right
+    // child in every merge after that
+    authentication_path.push_back(acc);
+    for (size_t height = location.height + 1; height < merges; height++) {
+        authentication_path.push_back(old_peaks[old_peaks.size() - 1 - height]);
+    }
+}
+
+MmrAccumulator::MmrAccumulator(uint64_t num_leaves, std::vector<Digest> peaks)
+    : num_leaves_(num_leaves), peaks_(std::move(peaks)) {
+    if (peaks_.size() != num_ones(num_leaves_)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfPeaks,
+                              std::to_string(peaks_.size()) + " peaks for " + std::to_string(num_leaves_) + " leaves");
+    }
+}
+
+void MmrAccumulator::append(const Digest& leaf) {
+    Digest acc = leaf;
+    for (size_t merges = num_trailing_ones(num_leaves_); merges > 0; merges--) {
+        acc = Tip5::hash_pair(peaks_.back(), acc);
+        peaks_.pop_back();
+    }
+    peaks_.push_back(acc);
+    num_leaves_++;
+}
+
+Digest MmrAccumulator::bag_peaks() const {
+    std::vector<BFieldElement> input;
+    input.reserve(1 + peaks_.size() * Digest::LEN);
+    input.push_back(BFieldElement::new_element(num_leaves_));
+    for (const auto& peak : peaks_) {
+        input.insert(input.end(), peak.values().begin(), peak.values().end());
+    }
+    return Tip5::hash_varlen(input);
+}
+
+std::vector<uint8_t> MmrAccumulator::to_bytes() const {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(sizeof(uint64_t) + peaks_.size() * Digest::BYTES);
+    for (size_t i = 0; i < sizeof(uint64_t); i++) {
+        bytes.push_back(static_cast<uint8_t>(num_leaves_ >> (8 * i)));
+    }
+    for (const auto& peak : peaks_) {
+        auto peak_bytes = peak.to_bytes();
+        bytes.insert(bytes.end(), peak_bytes.begin(), peak_bytes.end());
+    }
+    return bytes;
+}
+
+std::optional<MmrAccumulator> MmrAccumulator::from_bytes(const std::vector<uint8_t>& bytes) {
+    if (bytes.size() < sizeof(uint64_t)) {
+        return std::nullopt;
+    }
+
+    uint64_t num_leaves = 0;
+    for (size_t i = sizeof(uint64_t); i-- > 0;) {
+        num_leaves = (num_leaves << 8) | bytes[i];
+    }
+    if (bytes.size() != sizeof(uint64_t) + num_ones(num_leaves) * Digest::BYTES) {
+        return std::nullopt;
+    }
+
+    std::vector<Digest> peaks;
+    for (size_t offset = sizeof(uint64_t); offset < bytes.size(); offset += Digest::BYTES) {
+        std::array<uint8_t, Digest::BYTES> peak_bytes;
+        std::copy_n(bytes.begin() + offset, Digest::BYTES, peak_bytes.begin());
+        auto peak = Digest::from_bytes(peak_bytes);
+        if (!peak) {
+            return std::nullopt;
+        }
+        peaks.push_back(*peak);
+    }
+
+    return MmrAccumulator(num_leaves, std::move(peaks));
+}
+
+uint64_t ArchivalMmr::append(const Digest& leaf) {
+    if (levels_.empty()) {
+        levels_.emplace_back();
+    }
+
+    uint64_t leaf_index = levels_[0].size();
+    levels_[0].push_back(leaf);
+
+    // A node with an odd index completes its parent
+    for (size_t height = 0; levels_[height].size() % 2 == 0; height++) {
+        if (height + 1 == levels_.size()) {
+            levels_.emplace_back();
+        }
+        const auto& level = levels_[height];
+        levels_[height + 1].push_back(Tip5::hash_pair(level[level.size() - 2], level.back()));
+    }
+
+    return leaf_index;
+}
+
+const Digest& ArchivalMmr::leaf(uint64_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    return levels_[0][leaf_index];
+}
+
+std::vector<Digest> ArchivalMmr::peaks() const {
+    std::vector<Digest> peaks;
+    uint64_t offset = 0;
+    for (size_t height = levels_.size(); height-- > 0;) {
+        uint64_t size = uint64_t{1} << height;
+        if (num_leaves() & size) {
+            peaks.push_back(levels_[height][offset >> height]);
+            offset += size;
+        }
+    }
+    return peaks;
+}
+
+MmrMembershipProof ArchivalMmr::prove(uint64_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+
+    auto location = locate_leaf(num_leaves(), leaf_index);
+    MmrMembershipProof proof;
+    proof.leaf_index = leaf_index;
+    for (size_t height = 0; height < location.height; height++) {
+        proof.authentication_path.push_back(levels_[height][(leaf_index >> height) ^ 1]);
+    }
+    return proof;
+}
+
+} // namespace tip5xx
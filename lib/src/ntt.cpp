@@ -0,0 +1,419 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include "tip5xx/ntt.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// The bit reversal of lengths of at least 2^(2 * TILE_LOG + 2) goes
+// through two buffers of TILE x TILE elements
+constexpr size_t TILE_LOG = 5;
+constexpr size_t TILE = size_t{1} << TILE_LOG;
+
+size_t log2_exact(size_t n) {
+    size_t log = 0;
+    while ((n >> log) > 1) {
+        log++;
+    }
+    return log;
+}
+
+size_t reverse_bits(size_t x, size_t bits) {
+    uint64_t v = x;
+    v = ((v >> 1) & 0x5555555555555555ULL) | ((v & 0x5555555555555555ULL) << 1);
+    v = ((v >> 2) & 0x3333333333333333ULL) | ((v & 0x3333333333333333ULL) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((v & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    v = ((v >> 8) & 0x00FF00FF00FF00FFULL) | ((v & 0x00FF00FF00FF00FFULL) << 8);
+    v = ((v >> 16) & 0x0000FFFF0000FFFFULL) | ((v & 0x0000FFFF0000FFFFULL) << 16);
+    v = (v >> 32) | (v << 32);
+    return bits == 0 ? 0 : static_cast<size_t>(v >> (64 - bits));
+}
+
+// BFieldElement's operators live in its translation unit; the butterflies
+// use these inlined copies on the Montgomery representation instead
+inline BFieldElement mul(const BFieldElement& a, const BFieldElement& b) {
+    return BFieldElement::from_raw_u64(BFieldElement::montyred(
+        static_cast<__uint128_t>(a.raw_u64()) * static_cast<__uint128_t>(b.raw_u64())));
+}
+
+inline BFieldElement add(const BFieldElement& a, const BFieldElement& b) {
+    uint64_t x;
+    bool overflow = __builtin_sub_overflow(a.raw_u64(), BFieldElement::P - b.raw_u64(), &x);
+    return BFieldElement::from_raw_u64(overflow ? x + BFieldElement::P : x);
+}
+
+inline BFieldElement sub(const BFieldElement& a, const BFieldElement& b) {
+    uint64_t x;
+    bool underflow = __builtin_sub_overflow(a.raw_u64(), b.raw_u64(), &x);
+    return BFieldElement::from_raw_u64(underflow ? x + BFieldElement::P : x);
+}
+
+// omega_64 = 2^39 and 2 has order 192, so for m dividing 64 every power
+// of omega_m is a power of two
+constexpr size_t OMEGA_64_LOG = 39;
+constexpr size_t TWO_ORDER = 192;
+
+// a * 2^E for E < 192, as a shift and a reduction; scaling commutes with
+// the Montgomery representation
+template <size_t E>
+inline BFieldElement mul_pow2(const BFieldElement& a) {
+    // 2^96 = -1 and 2^64 = 2^32 - 1
+    constexpr bool negate = E >= TWO_ORDER / 2;
+    constexpr size_t e = negate ? E - TWO_ORDER / 2 : E;
+    uint64_t r;
+    if constexpr (e == 0) {
+        r = a.raw_u64();
+    } else if constexpr (e <= 32) {
+        // Below 2^96: lo + 2^64 hi = lo + (2^32 - 1) hi with hi < 2^32
+        const uint64_t lo = a.raw_u64() << e;
+        const uint64_t hi = a.raw_u64() >> (64 - e);
+        r = lo + ((hi << 32) - hi);
+        if (r < lo) {
+            r += 0xFFFFFFFFULL;
+        }
+    } else {
+        const __uint128_t x = a.raw_u64();
+        r = BFieldElement::mod_reduce(e < 64 ? x << e : (x << (e - 32)) - (x << (e - 64)));
+    }
+    if (r >= BFieldElement::P) {
+        r -= BFieldElement::P;
+    }
+    if constexpr (negate) {
+        r = r == 0 ? 0 : BFieldElement::P - r;
+    }
+    return BFieldElement::from_raw_u64(r);
+}
+
+// Butterflies (j, j + h) of every block of 2h at the given level
+template <size_t LOG, size_t LEVEL, size_t... J>
+inline void shift_level(BFieldElement* x, std::index_sequence<J...>) {
+    constexpr size_t h = size_t{1} << LEVEL;
+    // omega_2h = 2^step
+    constexpr size_t step = OMEGA_64_LOG * (32 / h) % TWO_ORDER;
+    for (size_t block = 0; block < (size_t{1} << LOG); block += 2 * h) {
+        BFieldElement* y = x + block;
+        ((y[J + h] = mul_pow2<step * J % TWO_ORDER>(y[J + h])), ...);
+        BFieldElement a, t;
+        ((a = y[J], t = y[J + h], y[J] = add(a, t), y[J + h] = sub(a, t)), ...);
+    }
+}
+
+// The first LOG decimation-in-time levels on a bit-reversed block of
+// 2^LOG <= 64 values; every twiddle is a compile-time power of two
+template <size_t LOG, size_t... LEVEL>
+void shift_kernel(BFieldElement* x, std::index_sequence<LEVEL...>) {
+    (shift_level<LOG, LEVEL>(x, std::make_index_sequence<size_t{1} << LEVEL>()), ...);
+}
+
+template <size_t LOG>
+void shift_kernel(BFieldElement* x) {
+    shift_kernel<LOG>(x, std::make_index_sequence<LOG>());
+}
+
+void radix2_level(BFieldElement* values, size_t length, size_t level) {
+    const size_t h = size_t{1} << level;
+    const BFieldElement* w = Ntt::twiddles(level);
+    for (size_t block = 0; block < length; block += 2 * h) {
+        BFieldElement* x = values + block;
+        for (size_t j = 0; j < h; j++) {
+            BFieldElement t = mul(w[j], x[j + h]);
+            x[j + h] = sub(x[j], t);
+            x[j] = add(x[j], t);
+        }
+    }
+}
+
+void check_length(size_t length) {
+    if (!Ntt::is_valid_length(length)) {
+        throw NttError(NttError::ErrorType::InvalidLength, std::to_string(length));
+    }
+}
+
+// The index with high bits `high`, TILE_LOG low bits `low` and the
+// middle bits `middle` in between
+inline size_t tile_index(size_t high, size_t middle, size_t low, size_t middle_bits) {
+    return (((high << middle_bits) | middle) << TILE_LOG) | low;
+}
+
+// Swaps the tiles of middle bits m and rev(m) through L1-resident buffers,
+// so that every access to the array touches TILE contiguous elements
+void bit_reverse_tiled(BFieldElement* values, size_t log_length) {
+    const size_t middle_bits = log_length - 2 * TILE_LOG;
+    std::array<size_t, TILE> reversed_low;
+    for (size_t i = 0; i < TILE; i++) {
+        reversed_low[i] = reverse_bits(i, TILE_LOG);
+    }
+
+    std::vector<BFieldElement> tile(TILE * TILE);
+    std::vector<BFieldElement> mirror_tile(TILE * TILE);
+    for (size_t middle = 0; middle < (size_t{1} << middle_bits); middle++) {
+        const size_t mirror = reverse_bits(middle, middle_bits);
+        if (mirror < middle) {
+            continue;
+        }
+        for (size_t high = 0; high < TILE; high++) {
+            std::copy_n(values + tile_index(high, middle, 0, middle_bits), TILE, tile.data() + high * TILE);
+            if (mirror != middle) {
+                std::copy_n(values + tile_index(high, mirror, 0, middle_bits), TILE, mirror_tile.data() + high * TILE);
+            }
+        }
+        // (high, middle, low) goes to (rev(low), rev(middle), rev(high))
+        for (size_t low = 0; low < TILE; low++) {
+            BFieldElement* row = values + tile_index(reversed_low[low], mirror, 0, middle_bits);
+            BFieldElement* mirror_row = values + tile_index(reversed_low[low], middle, 0, middle_bits);
+            for (size_t high = 0; high < TILE; high++) {
+                row[reversed_low[high]] = tile[high * TILE + low];
+                if (mirror != middle) {
+                    mirror_row[reversed_low[high]] = mirror_tile[high * TILE + low];
+                }
+            }
+        }
+    }
+}
+
+// dst (cols x rows) = transpose of src (rows x cols), both multiples of
+// TILE, one task per TILE rows
+void transpose(const BFieldElement* src, BFieldElement* dst, size_t rows, size_t cols, ThreadPool& pool) {
+    pool.parallel_for(0, rows / TILE, [=](size_t row_block) {
+        for (size_t col_block = 0; col_block < cols; col_block += TILE) {
+            for (size_t row = row_block * TILE; row < (row_block + 1) * TILE; row++) {
+                for (size_t col = col_block; col < col_block + TILE; col++) {
+                    dst[col * rows + row] = src[row * cols + col];
+                }
+            }
+        }
+    });
+}
+
+// Rows of the given length processed by one task
+size_t rows_per_task(size_t row_length) {
+    return std::max<size_t>(1, (size_t{1} << 14) / row_length);
+}
+
+void scale(BFieldElement* values, size_t length, const BFieldElement& factor, ThreadPool& pool) {
+    constexpr size_t CHUNK = size_t{1} << 14;
+    pool.parallel_for(0, (length + CHUNK - 1) / CHUNK, [=](size_t chunk) {
+        for (size_t i = chunk * CHUNK; i < std::min(length, (chunk + 1) * CHUNK); i++) {
+            values[i] = mul(values[i], factor);
+        }
+    });
+}
+
+} // namespace
+
+const BFieldElement* Ntt::twiddles(size_t level) {
+    static std::array<std::vector<BFieldElement>, MAX_LOG_LENGTH> tables;
+    static std::array<std::once_flag, MAX_LOG_LENGTH> computed;
+    if (level >= MAX_LOG_LENGTH) {
+        throw NttError(NttError::ErrorType::InvalidLength, "no twiddles for level " + std::to_string(level));
+    }
+    std::call_once(computed[level], [level] {
+        const size_t half = size_t{1} << level;
+        const BFieldElement omega = BFieldElement::primitive_root_of_unity(2 * half);
+        auto& table = tables[level];
+        table.resize(half);
+        BFieldElement power = BFieldElement::one();
+        for (size_t j = 0; j < half; j++) {
+            table[j] = power;
+            power *= omega;
+        }
+    });
+    return tables[level].data();
+}
+
+void Ntt::bit_reverse(BFieldElement* values, size_t length) {
+    check_length(length);
+    const size_t log_length = log2_exact(length);
+    if (log_length >= 2 * TILE_LOG + 2) {
+        bit_reverse_tiled(values, log_length);
+        return;
+    }
+    for (size_t i = 0; i < length; i++) {
+        size_t j = reverse_bits(i, log_length);
+        if (i < j) {
+            std::swap(values[i], values[j]);
+        }
+    }
+}
+
+void Ntt::forward(std::vector<BFieldElement>& values) {
+    forward(values.data(), values.size());
+}
+
+void Ntt::inverse(std::vector<BFieldElement>& values) {
+    inverse(values.data(), values.size());
+}
+
+void Ntt::forward(BFieldElement* values, size_t length) {
+    check_length(length);
+    const size_t log_length = log2_exact(length);
+    bit_reverse(values, length);
+
+    // The levels within blocks of 64, 16 or 8 have power-of-two twiddles
+    size_t level = 0;
+    if (log_length >= 6) {
+        for (size_t block = 0; block < length; block += 64) {
+            shift_kernel<6>(values + block);
+        }
+        level = 6;
+    } else if (log_length >= 4) {
+        for (size_t block = 0; block < length; block += 16) {
+            shift_kernel<4>(values + block);
+        }
+        level = 4;
+    } else if (log_length == 3) {
+        shift_kernel<3>(values);
+        level = 3;
+    }
+    if ((log_length - level) % 2 == 1) {
+        radix2_level(values, length, level);
+        level++;
+    }
+
+    // Levels `level` (span h, twiddles w) and `level + 1` (span 2h,
+    // twiddles u) at once, on blocks of 4h
+    for (; level < log_length; level += 2) {
+        const size_t h = size_t{1} << level;
+        const BFieldElement* w = twiddles(level);
+        const BFieldElement* u = twiddles(level + 1);
+        for (size_t block = 0; block < length; block += 4 * h) {
+            BFieldElement* x = values + block;
+            for (size_t j = 0; j < h; j++) {
+                BFieldElement t1 = mul(w[j], x[j + h]);
+                BFieldElement t3 = mul(w[j], x[j + 3 * h]);
+                BFieldElement b0 = add(x[j], t1);
+                BFieldElement b1 = sub(x[j], t1);
+                BFieldElement b2 = add(x[j + 2 * h], t3);
+                BFieldElement b3 = sub(x[j + 2 * h], t3);
+
+                BFieldElement t2 = mul(u[j], b2);
+                t3 = mul(u[j + h], b3);
+                x[j] = add(b0, t2);
+                x[j + 2 * h] = sub(b0, t2);
+                x[j + h] = add(b1, t3);
+                x[j + 3 * h] = sub(b1, t3);
+            }
+        }
+    }
+}
+
+void Ntt::forward_small(BFieldElement* values, size_t length) {
+    check_length(length);
+    bit_reverse(values, length);
+    switch (length) {
+        case 8:
+            shift_kernel<3>(values);
+            break;
+        case 16:
+            shift_kernel<4>(values);
+            break;
+        case 64:
+            shift_kernel<6>(values);
+            break;
+        default:
+            throw NttError(NttError::ErrorType::InvalidLength, "no shift-only kernel for " + std::to_string(length));
+    }
+}
+
+void Ntt::inverse(BFieldElement* values, size_t length) {
+    // f(omega^-i) = f(omega^(n-i)): a forward transform, reversed past the
+    // first value, and scaled by 1/n
+    forward(values, length);
+    std::reverse(values + 1, values + length);
+    const BFieldElement length_inverse = BFieldElement::new_element(length).inverse();
+    for (size_t i = 0; i < length; i++) {
+        values[i] = mul(values[i], length_inverse);
+    }
+}
+
+void Ntt::forward(std::vector<BFieldElement>& values, ThreadPool& pool) {
+    forward(values.data(), values.size(), pool);
+}
+
+void Ntt::inverse(std::vector<BFieldElement>& values, ThreadPool& pool) {
+    inverse(values.data(), values.size(), pool);
+}
+
+void Ntt::forward(BFieldElement* values, size_t length, ThreadPool& pool) {
+    check_length(length);
+    const size_t log_length = log2_exact(length);
+    if (log_length < FOUR_STEP_MIN_LOG_LENGTH) {
+        forward(values, length);
+        return;
+    }
+
+    // Index j = j1 + n1 * j2 of the input and k = k2 + n2 * k1 of the
+    // output, with j1, k1 < n1 and j2, k2 < n2:
+    // X[k] = sum_j1 omega_n^(j1 k2) omega_n1^(j1 k1) sum_j2 omega_n2^(j2 k2) x[j]
+    const size_t n1 = size_t{1} << (log_length / 2);
+    const size_t n2 = length / n1;
+    const BFieldElement omega = BFieldElement::primitive_root_of_unity(length);
+    std::vector<BFieldElement> scratch(length);
+    BFieldElement* rows = scratch.data();
+
+    // Row j1 of scratch is x[j1 + n1 * j2] over j2; transform it and
+    // scale by omega_n^(j1 k2)
+    transpose(values, rows, n2, n1, pool);
+    const size_t first_rows_per_task = rows_per_task(n2);
+    pool.parallel_for(0, n1 / first_rows_per_task, [=, &omega](size_t task) {
+        for (size_t j1 = task * first_rows_per_task; j1 < (task + 1) * first_rows_per_task; j1++) {
+            BFieldElement* row = rows + j1 * n2;
+            forward(row, n2);
+            const BFieldElement step = omega.mod_pow(j1);
+            BFieldElement factor = BFieldElement::one();
+            for (size_t k2 = 0; k2 < n2; k2++) {
+                row[k2] = mul(row[k2], factor);
+                factor = mul(factor, step);
+            }
+        }
+    });
+
+    // Row k2 of values is the above over j1; transform it into X[k2 + n2 * k1]
+    transpose(rows, values, n1, n2, pool);
+    const size_t second_rows_per_task = rows_per_task(n1);
+    pool.parallel_for(0, n2 / second_rows_per_task, [=](size_t task) {
+        for (size_t k2 = task * second_rows_per_task; k2 < (task + 1) * second_rows_per_task; k2++) {
+            forward(values + k2 * n1, n1);
+        }
+    });
+
+    transpose(values, rows, n2, n1, pool);
+    pool.parallel_for(0, n2 / second_rows_per_task, [=](size_t task) {
+        size_t first = task * second_rows_per_task * n1;
+        std::copy_n(rows + first, second_rows_per_task * n1, values + first);
+    });
+}
+
+void Ntt::inverse(BFieldElement* values, size_t length, ThreadPool& pool) {
+    forward(values, length, pool);
+    std::reverse(values + 1, values + length);
+    scale(values, length, BFieldElement::new_element(length).inverse(), pool);
+}
+
+} // namespace tip5xx
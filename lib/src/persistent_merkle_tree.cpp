@@ -0,0 +1,214 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <unordered_set>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/persistent_merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+PersistentMerkleTree::PersistentMerkleTree(const std::vector<Digest>& leaves)
+    : num_leaves_(leaves.size()), height_(0) {
+
+    auto tree = MerkleTree::build(leaves);
+    height_ = tree.height();
+
+    std::vector<NodePtr> level;
+    level.reserve(num_leaves_);
+    for (const auto& leaf : leaves) {
+        level.push_back(std::make_shared<Node>(Node{leaf, nullptr, nullptr}));
+    }
+    for (size_t width = num_leaves_ / 2; width >= 1; width /= 2) {
+        std::vector<NodePtr> parents;
+        parents.reserve(width);
+        for (size_t i = 0; i < width; i++) {
+            parents.push_back(std::make_shared<Node>(
+                Node{tree.node(width + i), std::move(level[2 * i]), std::move(level[2 * i + 1])}));
+        }
+        level = std::move(parents);
+    }
+
+    latest_ = level[0];
+    versions_.emplace(0, latest_);
+}
+
+PersistentMerkleTree::NodePtr PersistentMerkleTree::path_copy(
+    const NodePtr& node,
+    size_t depth,
+    size_t first_leaf,
+    const LeafUpdate* first,
+    const LeafUpdate* last,
+    std::vector<std::vector<Node*>>& fresh) const {
+
+    if (depth == height_) {
+        return std::make_shared<Node>(Node{(last - 1)->second, nullptr, nullptr});
+    }
+
+    size_t middle_leaf = first_leaf + (size_t{1} << (height_ - depth - 1));
+    const LeafUpdate* middle = std::lower_bound(first, last, middle_leaf,
+        [](const LeafUpdate& update, size_t leaf_index) { return update.first < leaf_index; });
+
+    auto copy = std::make_shared<Node>();
+    copy->left = first == middle ? node->left : path_copy(node->left, depth + 1, first_leaf, first, middle, fresh);
+    copy->right = middle == last ? node->right : path_copy(node->right, depth + 1, middle_leaf, middle, last, fresh);
+    fresh[depth].push_back(copy.get());
+    return copy;
+}
+
+uint64_t PersistentMerkleTree::update(const std::vector<std::pair<size_t, Digest>>& leaf_updates) {
+    for (const auto& [leaf_index, digest] : leaf_updates) {
+        if (leaf_index >= num_leaves_) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+        }
+    }
+
+    // Sorted by leaf index; of several updates to one leaf only the last
+    // one is kept
+    std::vector<LeafUpdate> sorted(leaf_updates.begin(), leaf_updates.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [](const LeafUpdate& a, const LeafUpdate& b) { return a.first < b.first; });
+    size_t num_unique = 0;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        if (i + 1 < sorted.size() && sorted[i + 1].first == sorted[i].first) {
+            continue;
+        }
+        sorted[num_unique++] = sorted[i];
+    }
+    sorted.resize(num_unique);
+
+    NodePtr root = latest_;
+    if (!sorted.empty()) {
+        std::vector<std::vector<Node*>> fresh(height_);
+        root = path_copy(latest_, 0, 0, sorted.data(), sorted.data() + sorted.size(), fresh);
+
+        std::vector<Digest> left;
+        std::vector<Digest> right;
+        std::vector<Digest> hashed;
+        for (size_t depth = height_; depth-- > 0;) {
+            const auto& level = fresh[depth];
+            left.resize(level.size());
+            right.resize(level.size());
+            hashed.resize(level.size());
+            for (size_t i = 0; i < level.size(); i++) {
+                left[i] = level[i]->left->digest;
+                right[i] = level[i]->right->digest;
+            }
+            Tip5::hash_pair_batch(left.data(), right.data(), hashed.data(), level.size());
+            for (size_t i = 0; i < level.size(); i++) {
+                level[i]->digest = hashed[i];
+            }
+        }
+    }
+
+    uint64_t version = next_version_++;
+    latest_ = root;
+    versions_.emplace(version, std::move(root));
+    return version;
+}
+
+const PersistentMerkleTree::NodePtr& PersistentMerkleTree::version_root(uint64_t version) const {
+    auto it = versions_.find(version);
+    if (it == versions_.end()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::UnknownVersion, std::to_string(version));
+    }
+    return it->second;
+}
+
+const PersistentMerkleTree::Node& PersistentMerkleTree::leaf_node(const NodePtr& root, size_t leaf_index) const {
+    if (leaf_index >= num_leaves_) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    const Node* node = root.get();
+    for (size_t depth = 0; depth < height_; depth++) {
+        bool go_right = (leaf_index >> (height_ - 1 - depth)) & 1;
+        node = go_right ? node->right.get() : node->left.get();
+    }
+    return *node;
+}
+
+Digest PersistentMerkleTree::root(uint64_t version) const {
+    return version_root(version)->digest;
+}
+
+Digest PersistentMerkleTree::leaf(uint64_t version, size_t leaf_index) const {
+    return leaf_node(version_root(version), leaf_index).digest;
+}
+
+std::vector<Digest> PersistentMerkleTree::authentication_path(uint64_t version, size_t leaf_index) const {
+    const NodePtr& root = version_root(version);
+    if (leaf_index >= num_leaves_) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+
+    // Siblings are met root first; the path lists them leaf first
+    std::vector<Digest> path(height_);
+    const Node* node = root.get();
+    for (size_t depth = 0; depth < height_; depth++) {
+        bool go_right = (leaf_index >> (height_ - 1 - depth)) & 1;
+        path[height_ - 1 - depth] = go_right ? node->left->digest : node->right->digest;
+        node = go_right ? node->right.get() : node->left.get();
+    }
+    return path;
+}
+
+std::vector<uint64_t> PersistentMerkleTree::versions() const {
+    std::vector<uint64_t> result;
+    result.reserve(versions_.size());
+    for (const auto& [version, root] : versions_) {
+        result.push_back(version);
+    }
+    return result;
+}
+
+void PersistentMerkleTree::release(uint64_t version) {
+    if (versions_.erase(version) == 0) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::UnknownVersion, std::to_string(version));
+    }
+}
+
+void PersistentMerkleTree::retain_last(size_t count) {
+    while (versions_.size() > count) {
+        versions_.erase(versions_.begin());
+    }
+}
+
+size_t PersistentMerkleTree::num_stored_nodes() const {
+    std::unordered_set<const Node*> seen;
+    std::vector<const Node*> pending = {latest_.get()};
+    for (const auto& [version, root] : versions_) {
+        pending.push_back(root.get());
+    }
+    while (!pending.empty()) {
+        const Node* node = pending.back();
+        pending.pop_back();
+        if (node == nullptr || !seen.insert(node).second) {
+            continue;
+        }
+        pending.push_back(node->left.get());
+        pending.push_back(node->right.get());
+    }
+    return seen.size();
+}
+
+} // namespace tip5xx
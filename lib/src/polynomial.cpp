@@ -0,0 +1,378 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <memory>
+#include "tip5xx/ntt.hpp"
+#include "tip5xx/polynomial.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+using Coefficients = std::vector<BFieldElement>;
+
+// Points per leaf of a subproduct tree
+constexpr size_t LEAF_POINTS = 32;
+
+void trim(Coefficients& a) {
+    while (!a.empty() && a.back().is_zero()) {
+        a.pop_back();
+    }
+}
+
+Coefficients multiply_schoolbook(const Coefficients& a, const Coefficients& b) {
+    Coefficients product(a.size() + b.size() - 1, BFieldElement::zero());
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) {
+            product[i + j] += a[i] * b[j];
+        }
+    }
+    return product;
+}
+
+Coefficients multiply_ntt(const Coefficients& a, const Coefficients& b) {
+    const size_t product_length = a.size() + b.size() - 1;
+    size_t length = 1;
+    while (length < product_length) {
+        length *= 2;
+    }
+    Coefficients a_values(length, BFieldElement::zero());
+    Coefficients b_values(length, BFieldElement::zero());
+    std::copy(a.begin(), a.end(), a_values.begin());
+    std::copy(b.begin(), b.end(), b_values.begin());
+    Ntt::forward(a_values);
+    Ntt::forward(b_values);
+    for (size_t i = 0; i < length; i++) {
+        a_values[i] *= b_values[i];
+    }
+    Ntt::inverse(a_values);
+    a_values.resize(product_length);
+    return a_values;
+}
+
+Coefficients multiply(const Coefficients& a, const Coefficients& b) {
+    if (a.empty() || b.empty()) {
+        return {};
+    }
+    if (std::min(a.size(), b.size()) < Polynomial::NTT_MULTIPLICATION_THRESHOLD) {
+        return multiply_schoolbook(a, b);
+    }
+    return multiply_ntt(a, b);
+}
+
+// The first `length` coefficients of a * b
+Coefficients multiply_truncated(const Coefficients& a, const Coefficients& b, size_t length) {
+    Coefficients product = multiply(
+        Coefficients(a.begin(), a.begin() + std::min(a.size(), length)),
+        Coefficients(b.begin(), b.begin() + std::min(b.size(), length)));
+    product.resize(length, BFieldElement::zero());
+    return product;
+}
+
+// g with f * g = 1 mod x^length, for f[0] != 0, by Newton iteration
+// g <- g * (2 - f * g), doubling the precision every step
+Coefficients inverse_series(const Coefficients& f, size_t length) {
+    Coefficients g = {f[0].inverse()};
+    for (size_t precision = 1; precision < length;) {
+        precision = std::min(2 * precision, length);
+        Coefficients error = multiply_truncated(f, g, precision);
+        for (auto& coefficient : error) {
+            coefficient = -coefficient;
+        }
+        error[0] += BFieldElement::new_element(2);
+        g = multiply_truncated(g, error, precision);
+    }
+    return g;
+}
+
+// Long division; the divisor has no trailing zeros
+std::pair<Coefficients, Coefficients> divide_schoolbook(Coefficients remainder, const Coefficients& divisor) {
+    if (remainder.size() < divisor.size()) {
+        return {{}, remainder};
+    }
+    const size_t divisor_degree = divisor.size() - 1;
+    const BFieldElement lead_inverse = divisor.back().inverse();
+    Coefficients quotient(remainder.size() - divisor_degree, BFieldElement::zero());
+    for (size_t i = quotient.size(); i-- > 0;) {
+        BFieldElement factor = remainder[i + divisor_degree] * lead_inverse;
+        quotient[i] = factor;
+        if (factor.is_zero()) {
+            continue;
+        }
+        for (size_t j = 0; j <= divisor_degree; j++) {
+            remainder[i + j] -= factor * divisor[j];
+        }
+    }
+    remainder.resize(divisor_degree);
+    return {quotient, remainder};
+}
+
+// The quotient of a by b is the reversal of rev(a) / rev(b) mod x^(n-m+1),
+// for n and m the degrees of a and b
+std::pair<Coefficients, Coefficients> divide_newton(const Coefficients& a, const Coefficients& b) {
+    const size_t quotient_length = a.size() - b.size() + 1;
+    Coefficients reversed_a(a.rbegin(), a.rbegin() + quotient_length);
+    Coefficients reversed_b(b.rbegin(), b.rbegin() + std::min(b.size(), quotient_length));
+    Coefficients quotient = multiply_truncated(reversed_a, inverse_series(reversed_b, quotient_length), quotient_length);
+    std::reverse(quotient.begin(), quotient.end());
+
+    // The remainder is below x^m, where a and q * b agree
+    const size_t remainder_length = b.size() - 1;
+    Coefficients product = multiply_truncated(quotient, b, remainder_length);
+    Coefficients remainder(a.begin(), a.begin() + remainder_length);
+    for (size_t i = 0; i < remainder_length; i++) {
+        remainder[i] -= product[i];
+    }
+    return {quotient, remainder};
+}
+
+std::pair<Coefficients, Coefficients> divide(const Coefficients& a, const Coefficients& b) {
+    if (a.size() < b.size()) {
+        return {{}, a};
+    }
+    const size_t quotient_length = a.size() - b.size() + 1;
+    if (std::min(quotient_length, b.size()) < Polynomial::NEWTON_DIVISION_THRESHOLD) {
+        return divide_schoolbook(a, b);
+    }
+    return divide_newton(a, b);
+}
+
+BFieldElement horner(const Coefficients& a, const BFieldElement& point) {
+    BFieldElement value = BFieldElement::zero();
+    for (auto it = a.rbegin(); it != a.rend(); ++it) {
+        value = value * point + *it;
+    }
+    return value;
+}
+
+Coefficients zerofier_schoolbook(const BFieldElement* roots, size_t count) {
+    Coefficients product = {BFieldElement::one()};
+    for (size_t i = 0; i < count; i++) {
+        // product *= (x - roots[i])
+        product.push_back(BFieldElement::zero());
+        for (size_t j = product.size() - 1; j > 0; j--) {
+            product[j] = product[j - 1] - roots[i] * product[j];
+        }
+        product[0] = -roots[i] * product[0];
+    }
+    return product;
+}
+
+// Sum of weights[i] * product / (x - points[i]), where product is the
+// zerofier of the points, by synthetic division
+Coefficients weighted_lagrange_sum(const BFieldElement* points, const BFieldElement* weights, size_t count,
+                                   const Coefficients& product) {
+    Coefficients sum(count, BFieldElement::zero());
+    Coefficients quotient(count);
+    for (size_t i = 0; i < count; i++) {
+        BFieldElement carry = BFieldElement::zero();
+        for (size_t j = count; j-- > 0;) {
+            carry = product[j + 1] + carry * points[i];
+            quotient[j] = carry;
+        }
+        for (size_t j = 0; j < count; j++) {
+            sum[j] += weights[i] * quotient[j];
+        }
+    }
+    return sum;
+}
+
+// Node of a subproduct tree: the zerofier of points [begin, end)
+struct SubproductTree {
+    size_t begin;
+    size_t end;
+    Coefficients product;
+    std::unique_ptr<SubproductTree> left;
+    std::unique_ptr<SubproductTree> right;
+
+    SubproductTree(const std::vector<BFieldElement>& points, size_t begin, size_t end) : begin(begin), end(end) {
+        if (end - begin <= LEAF_POINTS) {
+            product = zerofier_schoolbook(points.data() + begin, end - begin);
+            return;
+        }
+        size_t middle = begin + (end - begin) / 2;
+        left = std::make_unique<SubproductTree>(points, begin, middle);
+        right = std::make_unique<SubproductTree>(points, middle, end);
+        product = multiply(left->product, right->product);
+    }
+
+    bool is_leaf() const { return !left; }
+
+    // values[i] = f(points[i]), taking f mod product down the tree
+    void evaluate(Coefficients f, const std::vector<BFieldElement>& points, BFieldElement* values) const {
+        f = divide(f, product).second;
+        if (is_leaf()) {
+            for (size_t i = begin; i < end; i++) {
+                values[i] = horner(f, points[i]);
+            }
+            return;
+        }
+        left->evaluate(f, points, values);
+        right->evaluate(std::move(f), points, values);
+    }
+
+    // Sum of weights[i] * product / (x - points[i]) over the node's points
+    Coefficients combine(const std::vector<BFieldElement>& points, const std::vector<BFieldElement>& weights) const {
+        if (is_leaf()) {
+            return weighted_lagrange_sum(points.data() + begin, weights.data() + begin, end - begin, product);
+        }
+        Coefficients left_sum = multiply(left->combine(points, weights), right->product);
+        Coefficients right_sum = multiply(right->combine(points, weights), left->product);
+        left_sum.resize(std::max(left_sum.size(), right_sum.size()), BFieldElement::zero());
+        for (size_t i = 0; i < right_sum.size(); i++) {
+            left_sum[i] += right_sum[i];
+        }
+        return left_sum;
+    }
+};
+
+} // namespace
+
+Polynomial::Polynomial(std::vector<BFieldElement> coefficients) : coefficients_(std::move(coefficients)) {
+    normalize();
+}
+
+void Polynomial::normalize() {
+    trim(coefficients_);
+}
+
+Polynomial Polynomial::zerofier(const std::vector<BFieldElement>& roots) {
+    if (roots.size() < FAST_INTERPOLATION_THRESHOLD) {
+        return Polynomial(zerofier_schoolbook(roots.data(), roots.size()));
+    }
+    return Polynomial(SubproductTree(roots, 0, roots.size()).product);
+}
+
+Polynomial Polynomial::interpolate(const std::vector<BFieldElement>& points,
+                                   const std::vector<BFieldElement>& values) {
+    if (points.size() != values.size()) {
+        throw PolynomialError(PolynomialError::ErrorType::InvalidInterpolation,
+                              std::to_string(points.size()) + " points for " +
+                              std::to_string(values.size()) + " values");
+    }
+    if (points.empty()) {
+        return Polynomial();
+    }
+
+    // Lagrange: f = sum values[i] / Z'(points[i]) * Z / (x - points[i])
+    // for Z the zerofier of the points
+    std::unique_ptr<SubproductTree> tree;
+    Coefficients zerofier;
+    std::vector<BFieldElement> denominators(points.size());
+    if (points.size() < FAST_INTERPOLATION_THRESHOLD) {
+        zerofier = zerofier_schoolbook(points.data(), points.size());
+        Coefficients derivative = Polynomial(zerofier).derivative().coefficients();
+        for (size_t i = 0; i < points.size(); i++) {
+            denominators[i] = horner(derivative, points[i]);
+        }
+    } else {
+        tree = std::make_unique<SubproductTree>(points, 0, points.size());
+        tree->evaluate(Polynomial(tree->product).derivative().coefficients(), points, denominators.data());
+    }
+    for (size_t i = 0; i < points.size(); i++) {
+        if (denominators[i].is_zero()) {
+            throw PolynomialError(PolynomialError::ErrorType::InvalidInterpolation,
+                                  "repeated point " + points[i].to_string());
+        }
+    }
+
+    auto weights = BFieldElement::batch_inversion(denominators);
+    for (size_t i = 0; i < points.size(); i++) {
+        weights[i] *= values[i];
+    }
+    if (tree) {
+        return Polynomial(tree->combine(points, weights));
+    }
+    return Polynomial(weighted_lagrange_sum(points.data(), weights.data(), points.size(), zerofier));
+}
+
+BFieldElement Polynomial::leading_coefficient() const {
+    return is_zero() ? BFieldElement::zero() : coefficients_.back();
+}
+
+BFieldElement Polynomial::evaluate(const BFieldElement& point) const {
+    return horner(coefficients_, point);
+}
+
+std::vector<BFieldElement> Polynomial::evaluate(const std::vector<BFieldElement>& points) const {
+    std::vector<BFieldElement> values(points.size());
+    if (points.size() < FAST_EVALUATION_THRESHOLD) {
+        for (size_t i = 0; i < points.size(); i++) {
+            values[i] = horner(coefficients_, points[i]);
+        }
+        return values;
+    }
+    SubproductTree(points, 0, points.size()).evaluate(coefficients_, points, values.data());
+    return values;
+}
+
+Polynomial Polynomial::derivative() const {
+    Coefficients result;
+    for (size_t i = 1; i < coefficients_.size(); i++) {
+        result.push_back(BFieldElement::new_element(i) * coefficients_[i]);
+    }
+    return Polynomial(std::move(result));
+}
+
+std::pair<Polynomial, Polynomial> Polynomial::divide(const Polynomial& divisor) const {
+    if (divisor.is_zero()) {
+        throw PolynomialError(PolynomialError::ErrorType::DivisionByZero);
+    }
+    auto [quotient, remainder] = tip5xx::divide(coefficients_, divisor.coefficients_);
+    return {Polynomial(std::move(quotient)), Polynomial(std::move(remainder))};
+}
+
+Polynomial Polynomial::operator+(const Polynomial& rhs) const {
+    Coefficients sum = coefficients_;
+    sum.resize(std::max(sum.size(), rhs.coefficients_.size()), BFieldElement::zero());
+    for (size_t i = 0; i < rhs.coefficients_.size(); i++) {
+        sum[i] += rhs.coefficients_[i];
+    }
+    return Polynomial(std::move(sum));
+}
+
+Polynomial Polynomial::operator-(const Polynomial& rhs) const {
+    return *this + (-rhs);
+}
+
+Polynomial Polynomial::operator*(const Polynomial& rhs) const {
+    return Polynomial(multiply(coefficients_, rhs.coefficients_));
+}
+
+Polynomial Polynomial::operator*(const BFieldElement& scalar) const {
+    Coefficients product = coefficients_;
+    for (auto& coefficient : product) {
+        coefficient *= scalar;
+    }
+    return Polynomial(std::move(product));
+}
+
+Polynomial Polynomial::operator-() const {
+    Coefficients negated = coefficients_;
+    for (auto& coefficient : negated) {
+        coefficient = -coefficient;
+    }
+    return Polynomial(std::move(negated));
+}
+
+} // namespace tip5xx
@@ -0,0 +1,44 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <sstream>
+#include "tip5xx/polynomial_error.hpp"
+
+namespace tip5xx {
+
+std::string PolynomialError::build_message(ErrorType type, const std::string& detail) {
+    std::ostringstream oss;
+    switch (type) {
+        case ErrorType::DivisionByZero:
+            oss << "polynomial division by zero";
+            if (!detail.empty()) {
+                oss << ": " << detail;
+            }
+            break;
+        case ErrorType::InvalidInterpolation:
+            oss << "cannot interpolate: " << detail;
+            break;
+    }
+    return oss.str();
+}
+
+} // namespace tip5xx
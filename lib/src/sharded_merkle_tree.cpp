@@ -0,0 +1,187 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "tip5xx/sharded_merkle_tree.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+constexpr char SUMMARY_MAGIC[8] = {'T', 'I', 'P', '5', 'S', 'H', 'R', '\0'};
+
+uint64_t load_u64(const uint8_t* bytes) {
+    uint64_t value = 0;
+    for (size_t i = 8; i-- > 0;) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+void store_u64(uint8_t* bytes, uint64_t value) {
+    for (size_t i = 0; i < 8; i++) {
+        bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+bool is_power_of_two(uint64_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+} // namespace
+
+std::string ShardedMerkleTree::shard_tree_path(const std::string& dir, uint64_t shard_index) {
+    return dir + "/shard-" + std::to_string(shard_index) + ".tree";
+}
+
+std::string ShardedMerkleTree::shard_summary_path(const std::string& dir, uint64_t shard_index) {
+    return dir + "/shard-" + std::to_string(shard_index) + ".root";
+}
+
+std::string ShardedMerkleTree::top_tree_path(const std::string& dir) {
+    return dir + "/top.tree";
+}
+
+Digest ShardedMerkleTree::build_shard(const std::string& leaves_path, uint64_t shard_index, uint64_t num_shards,
+                                      const std::string& dir) {
+    return build_shard(leaves_path, shard_index, num_shards, dir, ThreadPool::shared());
+}
+
+Digest ShardedMerkleTree::build_shard(const std::string& leaves_path, uint64_t shard_index, uint64_t num_shards,
+                                      const std::string& dir, ThreadPool& pool) {
+    const size_t leaves_size = MappedFile::open(leaves_path).size();
+    if (leaves_size % Digest::BYTES != 0) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile,
+                              "size of '" + leaves_path + "' is not a multiple of " + std::to_string(Digest::BYTES));
+    }
+    const uint64_t num_leaves = leaves_size / Digest::BYTES;
+    if (!is_power_of_two(num_leaves)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(num_leaves));
+    }
+    if (!is_power_of_two(num_shards) || num_shards > num_leaves || shard_index >= num_shards) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "shard " + std::to_string(shard_index) + " of " + std::to_string(num_shards));
+    }
+
+    const uint64_t shard_num_leaves = num_leaves / num_shards;
+    const auto tree_path = shard_tree_path(dir, shard_index);
+    MappedMerkleTree::build(leaves_path, shard_index * shard_num_leaves, shard_num_leaves, tree_path, pool);
+    const Digest root = MappedMerkleTree::open(tree_path).root();
+
+    std::array<uint8_t, SUMMARY_SIZE> summary{};
+    std::memcpy(summary.data(), SUMMARY_MAGIC, sizeof(SUMMARY_MAGIC));
+    store_u64(summary.data() + 8, VERSION);
+    store_u64(summary.data() + 16, shard_index);
+    store_u64(summary.data() + 24, num_shards);
+    store_u64(summary.data() + 32, num_leaves);
+    auto root_bytes = root.to_bytes();
+    std::memcpy(summary.data() + 64, root_bytes.data(), Digest::BYTES);
+
+    const auto summary_path = shard_summary_path(dir, shard_index);
+    std::ofstream out(summary_path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(summary.data()), summary.size());
+    if (!out) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::Io, "cannot write '" + summary_path + "'");
+    }
+    return root;
+}
+
+Digest ShardedMerkleTree::merge(const std::string& dir, uint64_t num_shards) {
+    if (!is_power_of_two(num_shards)) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "number of shards must be a power of two, but got " + std::to_string(num_shards));
+    }
+
+    // The shard roots, in order, are the leaves of the top tree
+    const auto roots_path = dir + "/top.leaves";
+    uint64_t num_leaves = 0;
+    {
+        std::ofstream roots(roots_path, std::ios::binary | std::ios::trunc);
+        for (uint64_t k = 0; k < num_shards; k++) {
+            const auto summary_path = shard_summary_path(dir, k);
+            std::array<uint8_t, SUMMARY_SIZE> summary{};
+            std::ifstream in(summary_path, std::ios::binary);
+            in.read(reinterpret_cast<char*>(summary.data()), summary.size());
+            if (!in || std::memcmp(summary.data(), SUMMARY_MAGIC, sizeof(SUMMARY_MAGIC)) != 0 ||
+                load_u64(summary.data() + 8) != VERSION) {
+                throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile, "'" + summary_path + "' is no shard summary");
+            }
+            if (load_u64(summary.data() + 16) != k || load_u64(summary.data() + 24) != num_shards ||
+                (k > 0 && load_u64(summary.data() + 32) != num_leaves)) {
+                throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile, "'" + summary_path + "' is from another build");
+            }
+            num_leaves = load_u64(summary.data() + 32);
+
+            std::array<uint8_t, Digest::BYTES> root_bytes;
+            std::memcpy(root_bytes.data(), summary.data() + 64, Digest::BYTES);
+            if (!Digest::from_bytes(root_bytes)) {
+                throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile, "bad root in '" + summary_path + "'");
+            }
+            roots.write(reinterpret_cast<const char*>(root_bytes.data()), root_bytes.size());
+        }
+        if (!roots) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::Io, "cannot write '" + roots_path + "'");
+        }
+    }
+
+    MappedMerkleTree::build(roots_path, top_tree_path(dir));
+    std::remove(roots_path.c_str());
+    return MappedMerkleTree::open(top_tree_path(dir)).root();
+}
+
+ShardedMerkleTree ShardedMerkleTree::open(const std::string& dir) {
+    auto top = MappedMerkleTree::open(top_tree_path(dir));
+
+    std::vector<MappedMerkleTree> shards;
+    shards.reserve(top.num_leaves());
+    for (uint64_t k = 0; k < top.num_leaves(); k++) {
+        shards.push_back(MappedMerkleTree::open(shard_tree_path(dir, k)));
+        if (shards[k].num_leaves() != shards[0].num_leaves() || shards[k].root() != top.leaf(k)) {
+            throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidFile,
+                                  "'" + shard_tree_path(dir, k) + "' does not match the top tree");
+        }
+    }
+    return ShardedMerkleTree(std::move(top), std::move(shards));
+}
+
+Digest ShardedMerkleTree::leaf(uint64_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    return shards_[leaf_index / shard_num_leaves_].leaf(leaf_index % shard_num_leaves_);
+}
+
+std::vector<Digest> ShardedMerkleTree::authentication_path(uint64_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    const uint64_t shard_index = leaf_index / shard_num_leaves_;
+    auto path = shards_[shard_index].authentication_path(leaf_index % shard_num_leaves_);
+    auto top_path = top_.authentication_path(shard_index);
+    path.insert(path.end(), top_path.begin(), top_path.end());
+    return path;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,206 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include <string>
+#include "tip5xx/sparse_merkle_tree.hpp"
+#include "tip5xx/merkle_tree_error.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+const std::array<Digest, SparseMerkleTree::DEPTH + 1>& SparseMerkleTree::default_digests() {
+    static const auto defaults = [] {
+        std::array<Digest, DEPTH + 1> result;
+        for (size_t level = 1; level <= DEPTH; level++) {
+            result[level] = Tip5::hash_pair(result[level - 1], result[level - 1]);
+        }
+        return result;
+    }();
+    return defaults;
+}
+
+Digest SparseMerkleTree::leaf_digest(const Digest& key, const Digest& value) {
+    return Tip5::hash_pair(key, value);
+}
+
+const Digest& SparseMerkleTree::node(size_t level, uint64_t index) const {
+    auto it = nodes_[level].find(index);
+    return it == nodes_[level].end() ? default_digests()[level] : it->second;
+}
+
+std::optional<Digest> SparseMerkleTree::get(const Digest& key) const {
+    auto it = entries_.find(slot(key));
+    if (it == entries_.end() || it->second.first != key) {
+        return std::nullopt;
+    }
+    return it->second.second;
+}
+
+void SparseMerkleTree::update(const std::vector<std::pair<Digest, std::optional<Digest>>>& updates) {
+    const auto& defaults = default_digests();
+
+    // Replay the batch on the slot owners before touching anything, so a
+    // collision leaves the tree as it was
+    std::unordered_map<uint64_t, std::optional<Digest>> owners;
+    for (const auto& [key, value] : updates) {
+        uint64_t index = slot(key);
+        auto it = owners.find(index);
+        if (it == owners.end()) {
+            auto entry = entries_.find(index);
+            std::optional<Digest> owner;
+            if (entry != entries_.end()) {
+                owner = entry->second.first;
+            }
+            it = owners.emplace(index, owner).first;
+        }
+        if (value) {
+            if (it->second && *it->second != key) {
+                throw MerkleTreeError(MerkleTreeError::ErrorType::SlotOccupied, std::to_string(index));
+            }
+            it->second = key;
+        } else if (it->second == key) {
+            it->second.reset();
+        }
+    }
+
+    std::vector<uint64_t> dirty;
+    std::vector<Digest> keys, values;
+    for (const auto& [key, value] : updates) {
+        uint64_t index = slot(key);
+        if (value) {
+            entries_[index] = {key, *value};
+        } else {
+            auto it = entries_.find(index);
+            if (it == entries_.end() || it->second.first != key) {
+                continue;
+            }
+            entries_.erase(it);
+        }
+        dirty.push_back(index);
+    }
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+    // Leaves, from the final state of each slot
+    for (uint64_t index : dirty) {
+        auto it = entries_.find(index);
+        if (it == entries_.end()) {
+            nodes_[0].erase(index);
+        } else {
+            keys.push_back(it->second.first);
+            values.push_back(it->second.second);
+        }
+    }
+    std::vector<Digest> leaves(keys.size());
+    Tip5::hash_pair_batch(keys.data(), values.data(), leaves.data(), keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        nodes_[0][slot(keys[i])] = leaves[i];
+    }
+
+    // Inner nodes, one level at a time. A parent of two empty subtrees is
+    // itself empty and needs no hashing.
+    std::vector<uint64_t> parents, hashed;
+    std::vector<Digest> left, right, digests;
+    for (size_t level = 0; level < DEPTH; level++) {
+        parents.clear();
+        hashed.clear();
+        left.clear();
+        right.clear();
+        for (uint64_t index : dirty) {
+            uint64_t parent = index >> 1;
+            if (!parents.empty() && parents.back() == parent) {
+                continue;
+            }
+            parents.push_back(parent);
+
+            const Digest& l = node(level, parent << 1);
+            const Digest& r = node(level, (parent << 1) | 1);
+            if (l == defaults[level] && r == defaults[level]) {
+                nodes_[level + 1].erase(parent);
+                continue;
+            }
+            hashed.push_back(parent);
+            left.push_back(l);
+            right.push_back(r);
+        }
+
+        digests.resize(hashed.size());
+        Tip5::hash_pair_batch(left.data(), right.data(), digests.data(), hashed.size());
+        for (size_t i = 0; i < hashed.size(); i++) {
+            nodes_[level + 1][hashed[i]] = digests[i];
+        }
+        std::swap(dirty, parents);
+    }
+}
+
+SparseMerkleProof SparseMerkleTree::prove(const Digest& key) const {
+    const auto& defaults = default_digests();
+
+    SparseMerkleProof proof;
+    uint64_t index = slot(key);
+    for (size_t level = 0; level < DEPTH; level++, index >>= 1) {
+        const Digest& sibling = node(level, index ^ 1);
+        if (sibling != defaults[level]) {
+            proof.non_default_siblings |= uint64_t{1} << level;
+            proof.siblings.push_back(sibling);
+        }
+    }
+    return proof;
+}
+
+size_t SparseMerkleTree::num_stored_nodes() const {
+    size_t count = 0;
+    for (const auto& level : nodes_) {
+        count += level.size();
+    }
+    return count;
+}
+
+bool SparseMerkleProof::verify(const Digest& root, const Digest& key, const std::optional<Digest>& value) const {
+    const auto& defaults = SparseMerkleTree::default_digests();
+
+    size_t num_siblings = 0;
+    for (uint64_t bits = non_default_siblings; bits != 0; bits &= bits - 1) {
+        num_siblings++;
+    }
+    if (num_siblings != siblings.size()) {
+        return false;
+    }
+
+    uint64_t index = SparseMerkleTree::slot(key);
+    Digest acc = value ? SparseMerkleTree::leaf_digest(key, *value) : defaults[0];
+    auto next_sibling = siblings.begin();
+    for (size_t level = 0; level < SparseMerkleTree::DEPTH; level++, index >>= 1) {
+        bool has_sibling = (non_default_siblings >> level) & 1;
+        if (!has_sibling && acc == defaults[level]) {
+            acc = defaults[level + 1];
+            continue;
+        }
+        const Digest& sibling = has_sibling ? *next_sibling++ : defaults[level];
+        acc = (index & 1) ? Tip5::hash_pair(sibling, acc) : Tip5::hash_pair(acc, sibling);
+    }
+    return acc == root;
+}
+
+} // namespace tip5xx
@@ -0,0 +1,150 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include "tip5xx/strided_merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Number of parent nodes hashed by one task while building
+constexpr size_t BUILD_CHUNK = 1024;
+
+size_t log2_exact(size_t n) {
+    size_t log = 0;
+    while ((n >> log) > 1) {
+        log++;
+    }
+    return log;
+}
+
+// Hash the `count` sibling pairs of `children` into `parents`
+void hash_level(const Digest* children, size_t count, Digest* parents,
+                std::vector<Digest>& left, std::vector<Digest>& right) {
+    left.resize(count);
+    right.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        left[i] = children[2 * i];
+        right[i] = children[2 * i + 1];
+    }
+    Tip5::hash_pair_batch(left.data(), right.data(), parents, count);
+}
+
+// Reduce `num_parents << levels` nodes by `levels` levels in place
+void reduce(std::vector<Digest>& nodes, size_t levels) {
+    std::vector<Digest> left;
+    std::vector<Digest> right;
+    std::vector<Digest> parents;
+    for (size_t level = 0; level < levels; level++) {
+        parents.resize(nodes.size() / 2);
+        hash_level(nodes.data(), parents.size(), parents.data(), left, right);
+        nodes.swap(parents);
+    }
+}
+
+} // namespace
+
+StridedMerkleTree StridedMerkleTree::build(const std::vector<Digest>& leaves, size_t level_stride) {
+    return build(leaves, level_stride, ThreadPool::shared());
+}
+
+StridedMerkleTree StridedMerkleTree::build(const std::vector<Digest>& leaves, size_t level_stride, ThreadPool& pool) {
+    if (!MerkleTree::is_valid_num_leaves(leaves.size())) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(leaves.size()));
+    }
+    level_stride = std::max<size_t>(level_stride, 1);
+    const size_t height = log2_exact(leaves.size());
+
+    std::vector<std::vector<Digest>> levels = {leaves};
+    for (size_t level = 0; level < height; level += level_stride) {
+        const size_t block_height = std::min(level_stride, height - level);
+        const std::vector<Digest>& below = levels.back();
+        std::vector<Digest> above(below.size() >> block_height);
+
+        // Each task reduces the blocks under a contiguous range of parents
+        const size_t num_chunks = (above.size() + BUILD_CHUNK - 1) / BUILD_CHUNK;
+        pool.parallel_for(0, num_chunks, [&below, &above, block_height](size_t chunk) {
+            size_t first = chunk * BUILD_CHUNK;
+            size_t last = std::min(first + BUILD_CHUNK, above.size());
+            std::vector<Digest> nodes(below.begin() + (first << block_height),
+                                      below.begin() + (last << block_height));
+            reduce(nodes, block_height);
+            std::copy(nodes.begin(), nodes.end(), above.begin() + first);
+        });
+        levels.push_back(std::move(above));
+    }
+
+    return StridedMerkleTree(height, level_stride, std::move(levels));
+}
+
+const Digest& StridedMerkleTree::leaf(size_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    return levels_.front()[leaf_index];
+}
+
+std::vector<Digest> StridedMerkleTree::authentication_path(size_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+
+    std::vector<Digest> path;
+    path.reserve(height_);
+    std::vector<Digest> block;
+    std::vector<Digest> parents;
+    std::vector<Digest> left;
+    std::vector<Digest> right;
+    for (size_t j = 0; j + 1 < levels_.size(); j++) {
+        const size_t level = j * level_stride_;
+        const size_t block_height = std::min(level_stride_, height_ - level);
+
+        // Rebuild the subtree of height block_height above the stored level
+        // that holds the path; its levels yield the missing siblings
+        size_t index = leaf_index >> level;
+        size_t first = (index >> block_height) << block_height;
+        block.assign(levels_[j].begin() + first, levels_[j].begin() + first + (size_t{1} << block_height));
+        index -= first;
+        for (size_t k = 0; k < block_height; k++) {
+            path.push_back(block[index ^ 1]);
+            if (k + 1 < block_height) {
+                parents.resize(block.size() / 2);
+                hash_level(block.data(), parents.size(), parents.data(), left, right);
+                block.swap(parents);
+            }
+            index /= 2;
+        }
+    }
+    return path;
+}
+
+size_t StridedMerkleTree::num_stored_digests() const {
+    size_t total = 0;
+    for (const auto& level : levels_) {
+        total += level.size();
+    }
+    return total;
+}
+
+} // namespace tip5xx
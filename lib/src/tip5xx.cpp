@@ -20,11 +20,149 @@
 //
 // This file is a part of tip5xx library
 
+#include <algorithm>
 #include "tip5xx/tip5xx.hpp"
 #include "tip5xx/mds.hpp"
+#include "tip5xx/ntt.hpp"
 
 namespace tip5xx {
 
+namespace {
+
+using Lanes = U64Lanes<NUM_LANES>;
+
+// Chunks of at most this many hashes skip the lane-parallel permutation
+constexpr size_t SCALAR_TAIL_LANES = 5;
+
+// Recombine the lo and hi limbs of one MDS output element
+uint64_t combine_limbs(uint64_t lo, uint64_t hi) {
+    __uint128_t s = (lo >> 4) + (static_cast<__uint128_t>(hi) << 28);
+    uint64_t s_hi = static_cast<uint64_t>(s >> 64);
+    uint64_t s_lo = static_cast<uint64_t>(s);
+
+    uint64_t res;
+    bool over;
+    if (__builtin_add_overflow(s_lo, s_hi * 0xffffffffULL, &res)) {
+        over = true;
+    } else {
+        over = false;
+    }
+    return over ? res + 0xffffffffULL : res;
+}
+
+// Round constants in Montgomery representation
+const std::array<uint64_t, NUM_ROUNDS * STATE_SIZE>& round_constants_montgomery() {
+    static const auto constants = [] {
+        std::array<uint64_t, NUM_ROUNDS * STATE_SIZE> result{};
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = bfe_from(ROUND_CONSTANTS_RAW[i]).raw_u64();
+        }
+        return result;
+    }();
+    return constants;
+}
+
+// The Tip5 permutation applied to NUM_LANES independent states at once.
+// States are stored element-major, so every step of a round is a loop
+// over the lanes of one state element.
+void permutation_lanes(std::array<Lanes, STATE_SIZE>& state) {
+    const auto& constants = round_constants_montgomery();
+
+    for (size_t round_index = 0; round_index < NUM_ROUNDS; round_index++) {
+        // S-box layer: split-and-lookup ...
+        for (size_t i = 0; i < NUM_SPLIT_AND_LOOKUP; i++) {
+            for (size_t lane = 0; lane < NUM_LANES; lane++) {
+                uint64_t x = state[i].v[lane];
+                uint64_t y = 0;
+                for (size_t b = 0; b < 8; b++) {
+                    y |= static_cast<uint64_t>(LOOKUP_TABLE[(x >> (8 * b)) & 0xff]) << (8 * b);
+                }
+                state[i].v[lane] = y;
+            }
+        }
+
+        // ... and the power map x^7
+        for (size_t i = NUM_SPLIT_AND_LOOKUP; i < STATE_SIZE; i++) {
+            for (size_t lane = 0; lane < NUM_LANES; lane++) {
+                uint64_t x = state[i].v[lane];
+                uint64_t sq = BFieldElement::montyred(static_cast<__uint128_t>(x) * x);
+                uint64_t qu = BFieldElement::montyred(static_cast<__uint128_t>(sq) * sq);
+                uint64_t sq_qu = BFieldElement::montyred(static_cast<__uint128_t>(sq) * qu);
+                state[i].v[lane] = BFieldElement::montyred(static_cast<__uint128_t>(x) * sq_qu);
+            }
+        }
+
+        // MDS layer
+        std::array<Lanes, STATE_SIZE> lo, hi;
+        for (size_t i = 0; i < STATE_SIZE; i++) {
+            for (size_t lane = 0; lane < NUM_LANES; lane++) {
+                lo[i].v[lane] = state[i].v[lane] & 0xffffffffUL;
+                hi[i].v[lane] = state[i].v[lane] >> 32;
+            }
+        }
+        lo = generated_function(lo);
+        hi = generated_function(hi);
+
+        // Combine limbs and add round constants
+        for (size_t i = 0; i < STATE_SIZE; i++) {
+            BFieldElement constant = BFieldElement::from_raw_u64(constants[round_index * STATE_SIZE + i]);
+            for (size_t lane = 0; lane < NUM_LANES; lane++) {
+                BFieldElement element = BFieldElement::from_raw_u64(combine_limbs(lo[i].v[lane], hi[i].v[lane]));
+                state[i].v[lane] = (element + constant).raw_u64();
+            }
+        }
+    }
+}
+
+// hash_pair_batch, with a first capacity element of one unless
+// domain_tags is given
+void hash_pair_lanes(const Digest* left, const Digest* right, const BFieldElement* domain_tags,
+                     Digest* out, size_t count) {
+    for (size_t first = 0; first < count; first += NUM_LANES) {
+        size_t lanes = std::min(NUM_LANES, count - first);
+
+        // The lane-parallel permutation costs about as much as four or five
+        // scalar ones, so a tail of up to SCALAR_TAIL_LANES is cheaper
+        // hashed one by one
+        if (lanes <= SCALAR_TAIL_LANES) {
+            for (size_t lane = 0; lane < lanes; lane++) {
+                out[first + lane] = domain_tags
+                    ? Tip5::hash_pair(left[first + lane], right[first + lane], domain_tags[first + lane])
+                    : Tip5::hash_pair(left[first + lane], right[first + lane]);
+            }
+            break;
+        }
+
+        // Fixed-length domain: zero rate, capacity set to one. Unused
+        // lanes of the last chunk are permuted but never read.
+        std::array<Lanes, STATE_SIZE> state;
+        for (size_t i = 0; i < STATE_SIZE; i++) {
+            state[i].v.fill(i < RATE ? BFieldElement::zero().raw_u64() : BFieldElement::one().raw_u64());
+        }
+        for (size_t lane = 0; lane < lanes; lane++) {
+            for (size_t i = 0; i < Digest::LEN; i++) {
+                state[i].v[lane] = left[first + lane][i].raw_u64();
+                state[Digest::LEN + i].v[lane] = right[first + lane][i].raw_u64();
+            }
+            if (domain_tags) {
+                state[RATE].v[lane] = domain_tags[first + lane].raw_u64();
+            }
+        }
+
+        permutation_lanes(state);
+
+        for (size_t lane = 0; lane < lanes; lane++) {
+            std::array<BFieldElement, Digest::LEN> result;
+            for (size_t i = 0; i < Digest::LEN; i++) {
+                result[i] = BFieldElement::from_raw_u64(state[i].v[lane]);
+            }
+            out[first + lane] = Digest(result);
+        }
+    }
+}
+
+} // namespace
+
 void Tip5::split_and_lookup(BFieldElement& element) {
     auto bytes = element.raw_bytes();
     for (size_t i = 0; i < 8; i++) {
@@ -61,21 +199,33 @@ void Tip5::mds_generated() {
 
     // Combine elementwise as in Rust
     for (size_t i = 0; i < STATE_SIZE; i++) {
-        __uint128_t s = (lo[i] >> 4) + (static_cast<__uint128_t>(hi[i]) << 28);
-        uint64_t s_hi = static_cast<uint64_t>(s >> 64);
-        uint64_t s_lo = static_cast<uint64_t>(s);
-
-        uint64_t res;
-        bool over;
-        if (__builtin_add_overflow(s_lo, s_hi * 0xffffffffULL, &res)) {
-            over = true;
-        } else {
-            over = false;
-        }
-        state[i] = BFieldElement::from_raw_u64(over ? res + 0xffffffffULL : res);
+        state[i] = BFieldElement::from_raw_u64(combine_limbs(lo[i], hi[i]));
     }
 }
 
+void Tip5::mds_ntt() {
+    // NTT of the first column, scaled by 1/16 for the inverse transform
+    static const auto spectrum = [] {
+        std::array<BFieldElement, STATE_SIZE> column;
+        for (size_t i = 0; i < STATE_SIZE; i++) {
+            column[i] = bfe_from(MDS_MATRIX_FIRST_COLUMN[i]);
+        }
+        Ntt::forward_small(column.data(), STATE_SIZE);
+        const BFieldElement size_inverse = BFieldElement::new_element(STATE_SIZE).inverse();
+        for (auto& value : column) {
+            value *= size_inverse;
+        }
+        return column;
+    }();
+
+    Ntt::forward_small(state.data(), STATE_SIZE);
+    for (size_t i = 0; i < STATE_SIZE; i++) {
+        state[i] *= spectrum[i];
+    }
+    // The inverse transform: a forward one reversed past index 0
+    Ntt::forward_small(state.data(), STATE_SIZE);
+    std::reverse(state.begin() + 1, state.end());
+}
 
 void Tip5::round(size_t round_index) {
     sbox_layer();
@@ -134,7 +284,12 @@ std::array<BFieldElement, Digest::LEN> Tip5::hash_10(const std::array<BFieldElem
 }
 
 Digest Tip5::hash_pair(const Digest& left, const Digest& right) {
+    return hash_pair(left, right, BFieldElement::one());
+}
+
+Digest Tip5::hash_pair(const Digest& left, const Digest& right, BFieldElement domain_tag) {
     Tip5 sponge(Domain::FixedLength);
+    sponge.state[RATE] = domain_tag;
 
     // Copy left digest values
     for (size_t i = 0; i < Digest::LEN; i++) {
@@ -157,6 +312,15 @@ Digest Tip5::hash_pair(const Digest& left, const Digest& right) {
     return Digest(result);
 }
 
+void Tip5::hash_pair_batch(const Digest* left, const Digest* right, Digest* out, size_t count) {
+    hash_pair_lanes(left, right, nullptr, out, count);
+}
+
+void Tip5::hash_pair_batch(const Digest* left, const Digest* right, const BFieldElement* domain_tags,
+                           Digest* out, size_t count) {
+    hash_pair_lanes(left, right, domain_tags, out, count);
+}
+
 Digest Tip5::hash_varlen(const std::vector<BFieldElement>& input) {
     Tip5 sponge(Domain::VariableLength);
 
@@ -0,0 +1,195 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include "tip5xx/veb_merkle_tree.hpp"
+#include "tip5xx/thread_pool.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Parents hashed per task while build() fills the layout
+constexpr size_t BUILD_CHUNK = 256;
+
+size_t depth_of(size_t node_index) {
+    size_t depth = 0;
+    while ((node_index >> depth) > 1) {
+        depth++;
+    }
+    return depth;
+}
+
+} // namespace
+
+size_t VebMerkleTree::position(size_t num_levels, size_t depth, uint64_t index) {
+    size_t pos = 0;
+    while (num_levels > 1) {
+        size_t top = num_levels / 2;
+        size_t bottom = num_levels - top;
+        if (depth < top) {
+            num_levels = top;
+            continue;
+        }
+
+        // Skip the top tree and the bottom trees to the left of ours
+        depth -= top;
+        uint64_t subtree = index >> depth;
+        index &= (uint64_t{1} << depth) - 1;
+        pos += ((size_t{1} << top) - 1) + subtree * ((size_t{1} << bottom) - 1);
+        num_levels = bottom;
+    }
+    return pos;
+}
+
+VebMerkleTree::VebMerkleTree(size_t height)
+    : height_(height),
+      nodes_((size_t{2} << height) - 1),
+      top_root_depth_(height_),
+      top_size_(height_),
+      bottom_size_(height_) {
+
+    // Record every split of the recursive layout of the pair tree
+    std::vector<std::pair<size_t, size_t>> pending = {{0, height_}};
+    while (!pending.empty()) {
+        auto [root_depth, num_levels] = pending.back();
+        pending.pop_back();
+        if (num_levels <= 1) {
+            continue;
+        }
+        size_t top = num_levels / 2;
+        size_t bottom = num_levels - top;
+        size_t split_depth = root_depth + top;
+        top_root_depth_[split_depth] = root_depth;
+        top_size_[split_depth] = (size_t{1} << top) - 1;
+        bottom_size_[split_depth] = (size_t{1} << bottom) - 1;
+        pending.emplace_back(root_depth, top);
+        pending.emplace_back(split_depth, bottom);
+    }
+}
+
+VebMerkleTree::VebMerkleTree(const MerkleTree& tree) : VebMerkleTree(tree.height()) {
+    for (size_t node_index = 1; node_index < 2 * tree.num_leaves(); node_index++) {
+        nodes_[slot(node_index)] = tree.node(node_index);
+    }
+}
+
+VebMerkleTree VebMerkleTree::build(const std::vector<Digest>& leaves) {
+    if (!MerkleTree::is_valid_num_leaves(leaves.size())) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::IncorrectNumberOfLeaves, std::to_string(leaves.size()));
+    }
+
+    size_t height = 0;
+    while ((size_t{1} << height) < leaves.size()) {
+        height++;
+    }
+    VebMerkleTree tree(height);
+    for (size_t i = 0; i < leaves.size(); i++) {
+        tree.nodes_[tree.slot(leaves.size() + i)] = leaves[i];
+    }
+
+    // One level at a time; the children of a parent are the two halves of
+    // a pair, so they sit next to each other
+    for (size_t width = leaves.size() / 2; width >= 1; width /= 2) {
+        size_t num_chunks = (width + BUILD_CHUNK - 1) / BUILD_CHUNK;
+        ThreadPool::shared().parallel_for(0, num_chunks, [&tree, width](size_t chunk) {
+            size_t first = width + chunk * BUILD_CHUNK;
+            size_t count = std::min(first + BUILD_CHUNK, 2 * width) - first;
+            std::array<Digest, BUILD_CHUNK> left, right, hashed;
+            for (size_t i = 0; i < count; i++) {
+                const Digest* children = &tree.nodes_[tree.slot(2 * (first + i))];
+                left[i] = children[0];
+                right[i] = children[1];
+            }
+            Tip5::hash_pair_batch(left.data(), right.data(), hashed.data(), count);
+            for (size_t i = 0; i < count; i++) {
+                tree.nodes_[tree.slot(first + i)] = hashed[i];
+            }
+        });
+    }
+    return tree;
+}
+
+size_t VebMerkleTree::slot(size_t node_index) const {
+    if (node_index == MerkleTree::ROOT_INDEX) {
+        return 0;
+    }
+    size_t pair = node_index / 2;
+    size_t pair_depth = depth_of(pair);
+    size_t pos = position(height_, pair_depth, pair - (size_t{1} << pair_depth));
+    return 1 + 2 * pos + (node_index & 1);
+}
+
+const Digest& VebMerkleTree::node(size_t node_index) const {
+    if (node_index == 0 || node_index >= nodes_.size() + 1) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::InvalidArgument,
+                              "node " + std::to_string(node_index) + " of a tree of " + std::to_string(num_leaves()) +
+                              " leaves");
+    }
+    return nodes_[slot(node_index)];
+}
+
+const Digest& VebMerkleTree::leaf(size_t leaf_index) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+    return nodes_[slot(num_leaves() + leaf_index)];
+}
+
+void VebMerkleTree::path_positions(size_t leaf_index, size_t* positions) const {
+    // The pair at depth d on the path has index leaf_index >> (height - d)
+    // within its level
+    positions[0] = 0;
+    for (size_t depth = 1; depth < height_; depth++) {
+        size_t root_depth = top_root_depth_[depth];
+        size_t index = leaf_index >> (height_ - depth);
+        size_t subtree = index & ((size_t{1} << (depth - root_depth)) - 1);
+        positions[depth] = positions[root_depth] + top_size_[depth] + subtree * bottom_size_[depth];
+    }
+}
+
+std::vector<Digest> VebMerkleTree::authentication_path(size_t leaf_index) const {
+    std::vector<Digest> path(height_);
+    authentication_path(leaf_index, path.data());
+    return path;
+}
+
+void VebMerkleTree::authentication_path(size_t leaf_index, Digest* path) const {
+    if (leaf_index >= num_leaves()) {
+        throw MerkleTreeError(MerkleTreeError::ErrorType::LeafIndexOutOfBounds, std::to_string(leaf_index));
+    }
+
+    std::array<size_t, 64> positions;
+    path_positions(leaf_index, positions.data());
+
+    // The node at depth d + 1 on the path lives in pair d, next to its sibling
+    for (size_t depth = height_; depth-- > 0;) {
+        size_t is_right_child = (leaf_index >> (height_ - 1 - depth)) & 1;
+        *path++ = nodes_[1 + 2 * positions[depth] + (is_right_child ^ 1)];
+    }
+}
+
+} // namespace tip5xx
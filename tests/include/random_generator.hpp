@@ -26,6 +26,7 @@
 #include <random>
 #include <vector>
 #include "tip5xx/b_field_element.hpp"
+#include "tip5xx/digest.hpp"
 
 using namespace tip5xx;
 
@@ -88,4 +89,25 @@ public:
 
         return elements;
     }
+
+    // Generate random Digest
+    Digest random_digest() {
+        std::array<BFieldElement, Digest::LEN> elements;
+        for (auto& element : elements) {
+            element = random_bfe();
+        }
+        return Digest(elements);
+    }
+
+    // Generate multiple random Digests
+    std::vector<Digest> random_digests(size_t n) {
+        std::vector<Digest> digests;
+        digests.reserve(n);
+
+        for (size_t i = 0; i < n; i++) {
+            digests.push_back(random_digest());
+        }
+
+        return digests;
+    }
 };
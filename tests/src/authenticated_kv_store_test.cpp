@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <algorithm>
+#include <map>
+#include <gtest/gtest.h>
+#include "tip5xx/authenticated_kv_store.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class AuthenticatedKvStoreTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(AuthenticatedKvStoreTest, BehavesLikeMap) {
+    AuthenticatedKvStore store;
+    std::map<std::string, std::pair<Digest, Digest>> reference;
+    auto keys = rng.random_digests(200);
+
+    for (size_t round = 0; round < 5; round++) {
+        std::vector<std::pair<Digest, std::optional<Digest>>> updates;
+        for (size_t k = 0; k < 100; k++) {
+            const Digest& key = keys[rng.random_range(keys.size() - 1)];
+            if (rng.random_range(3) == 0) {
+                updates.emplace_back(key, std::nullopt);
+                reference.erase(key.to_hex());
+            } else {
+                Digest value = rng.random_digest();
+                updates.emplace_back(key, value);
+                reference[key.to_hex()] = {key, value};
+            }
+        }
+        store.update(updates);
+        EXPECT_TRUE(store.has_uncommitted_changes());
+        store.commit();
+        EXPECT_FALSE(store.has_uncommitted_changes());
+
+        EXPECT_EQ(store.size(), reference.size());
+        for (const auto& key : keys) {
+            auto it = reference.find(key.to_hex());
+            auto value = store.get(key);
+            ASSERT_EQ(value.has_value(), it != reference.end());
+            if (value) {
+                ASSERT_EQ(*value, it->second.second);
+            }
+        }
+    }
+}
+
+TEST_F(AuthenticatedKvStoreTest, RootDependsOnlyOnContents) {
+    auto keys = rng.random_digests(50);
+    auto values = rng.random_digests(50);
+
+    AuthenticatedKvStore forward;
+    for (size_t i = 0; i < keys.size(); i++) {
+        forward.put(keys[i], values[i]);
+    }
+    forward.commit();
+
+    // Different order, different commit points, and keys that come and go
+    AuthenticatedKvStore shuffled;
+    auto extra = rng.random_digests(10);
+    for (const auto& key : extra) {
+        shuffled.put(key, key);
+    }
+    shuffled.commit();
+    for (size_t i = keys.size(); i-- > 0;) {
+        shuffled.put(keys[i], i % 2 == 0 ? values[i] : extra[0]);
+        if (i % 7 == 0) {
+            shuffled.commit();
+        }
+    }
+    for (size_t i = 1; i < keys.size(); i += 2) {
+        shuffled.put(keys[i], values[i]);
+    }
+    for (const auto& key : extra) {
+        shuffled.remove(key);
+    }
+    EXPECT_EQ(shuffled.commit(), forward.root());
+
+    for (const auto& key : keys) {
+        shuffled.remove(key);
+    }
+    EXPECT_EQ(shuffled.commit(), Digest());
+    EXPECT_EQ(shuffled.size(), 0u);
+}
+
+TEST_F(AuthenticatedKvStoreTest, InclusionAndExclusionProofs) {
+    AuthenticatedKvStore store;
+    EXPECT_TRUE(store.prove(rng.random_digest()).verify(store.root(), rng.random_digest(), std::nullopt));
+
+    auto keys = rng.random_digests(64);
+    for (const auto& key : keys) {
+        store.put(key, key);
+    }
+    // A key that shares its first element with a stored one splits deep down
+    Digest near = keys[0];
+    near[4] = near[4] + BFieldElement::new_element(1);
+    store.put(near, keys[1]);
+    EXPECT_THROW(store.prove(near), MerkleTreeError);
+    const Digest root = store.commit();
+
+    for (const auto& key : keys) {
+        auto proof = store.prove(key);
+        EXPECT_TRUE(proof.verify(root, key, key));
+        EXPECT_FALSE(proof.verify(root, key, std::nullopt));
+        EXPECT_FALSE(proof.verify(root, key, rng.random_digest()));
+    }
+    EXPECT_TRUE(store.prove(near).verify(root, near, keys[1]));
+
+    for (const auto& absent : rng.random_digests(20)) {
+        auto proof = store.prove(absent);
+        EXPECT_TRUE(proof.verify(root, absent, std::nullopt));
+        EXPECT_FALSE(proof.verify(root, absent, absent));
+        // Not valid for a key on another path
+        EXPECT_FALSE(proof.verify(root, keys[5], std::nullopt));
+    }
+
+    // Tampered split bits or siblings
+    auto proof = store.prove(keys[3]);
+    ASSERT_FALSE(proof.bits.empty());
+    auto tampered = proof;
+    tampered.bits.back()++;
+    EXPECT_FALSE(tampered.verify(root, keys[3], keys[3]));
+    tampered = proof;
+    tampered.siblings.front() = rng.random_digest();
+    EXPECT_FALSE(tampered.verify(root, keys[3], keys[3]));
+}
+
+TEST_F(AuthenticatedKvStoreTest, SplitBitCannotBeOffsetBySibling) {
+    // K and L agree on bits 0 and 1 and split at bit 2, with K on the left
+    Digest k = rng.random_digest();
+    Digest l = k;
+    k[0] = BFieldElement::new_element(uint64_t{1} << 62);
+    l[0] = BFieldElement::new_element((uint64_t{1} << 62) | (uint64_t{1} << 61));
+    AuthenticatedKvStore store;
+    store.put(k, k);
+    store.put(l, l);
+    const Digest root = store.commit();
+
+    auto proof = store.prove(l);
+    ASSERT_EQ(proof.bits, std::vector<uint32_t>{2});
+    EXPECT_TRUE(proof.verify(root, l, l));
+
+    // Claim that L's leaf branches off K's path at bit 1, where both have
+    // a one, and shift the sibling to make up for the other split bit
+    auto forged = proof;
+    forged.bits[0] = 1;
+    forged.siblings[0] = AuthenticatedKvStore::leaf_digest(k, k);
+    forged.siblings[0][0] += BFieldElement::new_element(1);
+    EXPECT_FALSE(forged.verify(root, k, std::nullopt));
+    EXPECT_FALSE(forged.verify(root, l, l));
+}
+
+TEST_F(AuthenticatedKvStoreTest, RemovalOntoCleanSubtreeIsUncommitted) {
+    // Removing one of two keys collapses the root onto the other, clean leaf
+    AuthenticatedKvStore store;
+    auto keys = rng.random_digests(2);
+    store.put(keys[0], keys[0]);
+    store.put(keys[1], keys[1]);
+    const Digest old_root = store.commit();
+
+    store.remove(keys[0]);
+    EXPECT_TRUE(store.has_uncommitted_changes());
+    EXPECT_THROW(store.prove(keys[1]), MerkleTreeError);
+
+    const Digest new_root = store.commit();
+    EXPECT_NE(new_root, old_root);
+    EXPECT_FALSE(store.has_uncommitted_changes());
+    EXPECT_TRUE(store.prove(keys[1]).verify(new_root, keys[1], keys[1]));
+    EXPECT_TRUE(store.prove(keys[0]).verify(new_root, keys[0], std::nullopt));
+
+    // Removing an absent key changes nothing
+    store.remove(keys[0]);
+    EXPECT_FALSE(store.has_uncommitted_changes());
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/barycentric.hpp"
+#include "tip5xx/polynomial.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class BarycentricTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(BarycentricTest, MatchesPolynomialEvaluation) {
+    for (size_t n : {1u, 2u, 16u, 256u}) {
+        for (auto offset : {BFieldElement::one(), BFieldElement::generator()}) {
+            BarycentricEvaluator evaluator(n, offset);
+            Polynomial polynomial(rng.random_elements(n));
+            auto values = polynomial.evaluate(evaluator.domain());
+            for (size_t trial = 0; trial < 5; trial++) {
+                BFieldElement point = rng.random_bfe();
+                ASSERT_EQ(evaluator.evaluate(values, point), polynomial.evaluate(point)) << "n = " << n;
+            }
+        }
+    }
+}
+
+TEST_F(BarycentricTest, ReturnsValuesOnTheDomain) {
+    BarycentricEvaluator evaluator(64, BFieldElement::generator());
+    auto values = rng.random_elements(64);
+    for (size_t i : {0u, 1u, 37u, 63u}) {
+        EXPECT_EQ(evaluator.evaluate(values, evaluator.domain()[i]), values[i]);
+    }
+}
+
+TEST_F(BarycentricTest, EvaluatesColumnsAtOnePoint) {
+    const size_t n = 128;
+    BarycentricEvaluator evaluator(n, BFieldElement::generator());
+    ThreadPool pool(3);
+    // Whole and partial passes of columns
+    for (size_t num_columns : {1u, 4u, 7u, 13u}) {
+        std::vector<BFieldElement> columns;
+        std::vector<Polynomial> polynomials;
+        for (size_t c = 0; c < num_columns; c++) {
+            polynomials.emplace_back(rng.random_elements(n));
+            auto values = polynomials.back().evaluate(evaluator.domain());
+            columns.insert(columns.end(), values.begin(), values.end());
+        }
+        BFieldElement point = rng.random_bfe();
+        auto results = evaluator.evaluate_columns(columns, point);
+        EXPECT_EQ(evaluator.evaluate_columns(columns, point, pool), results);
+        ASSERT_EQ(results.size(), num_columns);
+        for (size_t c = 0; c < num_columns; c++) {
+            ASSERT_EQ(results[c], polynomials[c].evaluate(point));
+        }
+    }
+}
+
+TEST_F(BarycentricTest, AccumulatesLargeValuesWithoutOverflow) {
+    // Products near p^2 overflow the 128-bit accumulator many times
+    const size_t n = 1 << 12;
+    BarycentricEvaluator evaluator(n);
+    std::vector<BFieldElement> values(n, BFieldElement::new_element(BFieldElement::MAX_VALUE));
+    values[5] = BFieldElement::from_raw_u64(BFieldElement::MAX_VALUE);
+    BFieldElement point = rng.random_bfe();
+
+    // Reference: Lagrange terms with one inversion each
+    BFieldElement sum = BFieldElement::zero();
+    for (size_t i = 0; i < n; i++) {
+        const auto& x = evaluator.domain()[i];
+        sum += values[i] * x * (point - x).inverse();
+    }
+    BFieldElement expected = sum * (point.mod_pow(n) - BFieldElement::one()) * BFieldElement::new_element(n).inverse();
+    EXPECT_EQ(evaluator.evaluate(values, point), expected);
+}
+
+TEST_F(BarycentricTest, RejectsInvalidShapes) {
+    EXPECT_THROW(BarycentricEvaluator(12), NttError);
+    EXPECT_THROW(BarycentricEvaluator(16, BFieldElement::zero()), NttError);
+    BarycentricEvaluator evaluator(16);
+    EXPECT_THROW(evaluator.evaluate(rng.random_elements(15), BFieldElement::one()), NttError);
+    EXPECT_THROW(evaluator.evaluate_columns(rng.random_elements(40), BFieldElement::one()), NttError);
+}
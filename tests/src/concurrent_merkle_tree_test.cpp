@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <atomic>
+#include <thread>
+#include <gtest/gtest.h>
+#include "tip5xx/concurrent_merkle_tree.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class ConcurrentMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(ConcurrentMerkleTreeTest, CommitMatchesRebuild) {
+    for (size_t log_n : {0, 1, 6}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        ConcurrentMerkleTree tree(leaves);
+        EXPECT_EQ(tree.snapshot().epoch, 0u);
+        EXPECT_EQ(tree.snapshot().root, MerkleTree::build(leaves).root());
+
+        for (uint64_t epoch = 1; epoch <= 3; epoch++) {
+            for (size_t k = 0; k < 5; k++) {
+                size_t i = rng.random_range(leaves.size() - 1);
+                leaves[i] = rng.random_digest();
+                tree.set_leaf(i, leaves[i]);
+            }
+            auto expected = MerkleTree::build(leaves);
+            auto committed = tree.commit();
+            EXPECT_EQ(committed.epoch, epoch);
+            EXPECT_EQ(committed.root, expected.root());
+            EXPECT_EQ(tree.snapshot().root, expected.root());
+            for (size_t i = 0; i < leaves.size(); i++) {
+                ASSERT_EQ(tree.leaf(i), leaves[i]);
+                ASSERT_EQ(tree.authentication_path(i), expected.authentication_path(i));
+            }
+        }
+    }
+}
+
+TEST_F(ConcurrentMerkleTreeTest, SnapshotIsStaleUntilCommit) {
+    auto leaves = rng.random_digests(16);
+    ConcurrentMerkleTree tree(leaves);
+    auto before = tree.snapshot();
+    tree.set_leaf(3, rng.random_digest());
+    EXPECT_EQ(tree.snapshot().root, before.root);
+    EXPECT_NE(tree.commit().root, before.root);
+    EXPECT_THROW(tree.set_leaf(16, before.root), MerkleTreeError);
+    EXPECT_THROW(ConcurrentMerkleTree(rng.random_digests(3)), MerkleTreeError);
+}
+
+TEST_F(ConcurrentMerkleTreeTest, ConcurrentWritersAndCommits) {
+    const size_t num_writers = 4;
+    const size_t num_leaves = 256;
+    const size_t rounds = 200;
+    auto leaves = rng.random_digests(num_leaves);
+    ConcurrentMerkleTree tree(leaves);
+
+    // Writer w owns the leaves i with i % num_writers == w and writes them
+    // over and over; the final value of leaf i is final_leaves[i]
+    auto final_leaves = rng.random_digests(num_leaves);
+    std::atomic<bool> writers_done{false};
+    std::vector<std::thread> writers;
+    for (size_t w = 0; w < num_writers; w++) {
+        writers.emplace_back([&tree, &final_leaves, w]() {
+            RandomGenerator local_rng(w);
+            for (size_t round = 0; round < rounds; round++) {
+                for (size_t i = w; i < num_leaves; i += num_writers) {
+                    tree.set_leaf(i, round + 1 == rounds ? final_leaves[i] : local_rng.random_digest());
+                }
+            }
+        });
+    }
+
+    std::thread committer([&tree, &writers_done]() {
+        uint64_t last_epoch = 0;
+        while (!writers_done.load()) {
+            auto snapshot = tree.commit();
+            EXPECT_GT(snapshot.epoch, last_epoch);
+            last_epoch = snapshot.epoch;
+        }
+    });
+
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    writers_done.store(true);
+    committer.join();
+
+    EXPECT_EQ(tree.commit().root, MerkleTree::build(final_leaves).root());
+}
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/fri.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class FriTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    // Evaluations of the polynomial on offset * <omega>, by Horner's rule
+    static std::vector<BFieldElement> evaluate(const std::vector<BFieldElement>& coefficients,
+                                               const FriParameters& parameters) {
+        BFieldElement omega = BFieldElement::primitive_root_of_unity(parameters.domain_length);
+        BFieldElement x = parameters.domain_offset;
+        std::vector<BFieldElement> codeword;
+        for (size_t i = 0; i < parameters.domain_length; i++) {
+            BFieldElement value = BFieldElement::zero();
+            for (auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+                value = value * x + *it;
+            }
+            codeword.push_back(value);
+            x *= omega;
+        }
+        return codeword;
+    }
+
+    static FriParameters parameters(size_t domain_length, size_t expansion_factor, size_t num_queries) {
+        FriParameters parameters;
+        parameters.domain_length = domain_length;
+        parameters.expansion_factor = expansion_factor;
+        parameters.num_queries = num_queries;
+        return parameters;
+    }
+};
+
+TEST_F(FriTest, AcceptsLowDegreeCodewords) {
+    for (size_t expansion_factor : {2u, 4u, 8u}) {
+        auto params = parameters(512, expansion_factor, 20);
+        Fri fri(params);
+        auto codeword = evaluate(rng.random_elements(params.max_degree() + 1), params);
+        auto proof = fri.prove(codeword);
+        EXPECT_EQ(proof.rounds.size(), params.num_rounds());
+        EXPECT_EQ(proof.last_codeword.size(), expansion_factor);
+        EXPECT_TRUE(fri.verify(proof));
+    }
+}
+
+TEST_F(FriTest, RejectsHighDegreeCodewords) {
+    auto params = parameters(1024, 4, 30);
+    Fri fri(params);
+    EXPECT_FALSE(fri.verify(fri.prove(rng.random_elements(params.domain_length))));
+    // One degree too many
+    EXPECT_FALSE(fri.verify(fri.prove(evaluate(rng.random_elements(params.max_degree() + 2), params))));
+}
+
+TEST_F(FriTest, RejectsTamperedProofs) {
+    auto params = parameters(256, 4, 10);
+    Fri fri(params);
+    auto proof = fri.prove(evaluate(rng.random_elements(params.max_degree() + 1), params));
+    ASSERT_TRUE(fri.verify(proof));
+
+    auto tampered = proof;
+    tampered.rounds[1].revealed[3][0] += BFieldElement::one();
+    EXPECT_FALSE(fri.verify(tampered));
+
+    tampered = proof;
+    tampered.rounds[0].root = rng.random_digest();
+    EXPECT_FALSE(fri.verify(tampered));
+
+    tampered = proof;
+    for (auto& value : tampered.last_codeword) {
+        value += BFieldElement::one();
+    }
+    EXPECT_FALSE(fri.verify(tampered));
+
+    tampered = proof;
+    tampered.rounds.pop_back();
+    EXPECT_FALSE(fri.verify(tampered));
+
+    // Malformed later rounds are rejected before the folding checks read them
+    tampered = proof;
+    tampered.rounds[1].revealed.clear();
+    EXPECT_FALSE(fri.verify(tampered));
+
+    tampered = proof;
+    tampered.rounds[1].revealed.pop_back();
+    EXPECT_FALSE(fri.verify(tampered));
+
+    tampered = proof;
+    tampered.rounds.back().opening.indexed_leaves.pop_back();
+    EXPECT_FALSE(fri.verify(tampered));
+}
+
+TEST_F(FriTest, FoldHalvesTheDegree) {
+    auto params = parameters(64, 2, 1);
+    auto coefficients = rng.random_elements(32);
+    auto codeword = evaluate(coefficients, params);
+    BFieldElement challenge = rng.random_bfe();
+
+    // f_even + challenge * f_odd on the squared coset
+    std::vector<BFieldElement> folded_coefficients;
+    for (size_t i = 0; i < coefficients.size(); i += 2) {
+        folded_coefficients.push_back(coefficients[i] + challenge * coefficients[i + 1]);
+    }
+    auto folded_params = parameters(32, 2, 1);
+    folded_params.domain_offset = params.domain_offset * params.domain_offset;
+
+    auto folded = Fri::fold(codeword, params.domain_offset, challenge, ThreadPool::shared());
+    EXPECT_EQ(folded, evaluate(folded_coefficients, folded_params));
+}
+
+TEST_F(FriTest, CommitHashesCodewordPairs) {
+    auto codeword = rng.random_elements(16);
+    auto tree = Fri::commit(codeword, ThreadPool::shared());
+    ASSERT_EQ(tree.num_leaves(), 8u);
+    for (size_t i = 0; i < 8; i++) {
+        EXPECT_EQ(tree.leaf(i), Fri::leaf_digest(codeword[i], codeword[i + 8]));
+    }
+}
+
+TEST_F(FriTest, RejectsInvalidParameters) {
+    EXPECT_THROW(Fri(parameters(100, 4, 10)), FriError);
+    EXPECT_THROW(Fri(parameters(128, 3, 10)), FriError);
+    EXPECT_THROW(Fri(parameters(128, 1, 10)), FriError);
+    EXPECT_THROW(Fri(parameters(128, 256, 10)), FriError);
+    EXPECT_THROW(Fri(parameters(128, 4, 0)), FriError);
+
+    Fri fri(parameters(128, 4, 10));
+    EXPECT_THROW(fri.prove(rng.random_elements(64)), FriError);
+}
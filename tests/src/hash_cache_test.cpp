@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <thread>
+#include <gtest/gtest.h>
+#include "tip5xx/hash_cache.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class HashCacheTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(HashCacheTest, MatchesTip5AndCountsHits) {
+    HashCache cache(1 << 20);
+    auto left = rng.random_digests(50);
+    auto right = rng.random_digests(50);
+
+    for (size_t round = 0; round < 3; round++) {
+        for (size_t i = 0; i < left.size(); i++) {
+            ASSERT_EQ(cache.hash_pair(left[i], right[i]), Tip5::hash_pair(left[i], right[i]));
+        }
+    }
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.misses, 50u);
+    EXPECT_EQ(stats.hits, 100u);
+    EXPECT_NEAR(stats.hit_rate(), 2.0 / 3.0, 1e-9);
+
+    // hash_10 of the concatenated digests shares the entries of hash_pair
+    std::array<BFieldElement, RATE> input;
+    for (size_t i = 0; i < Digest::LEN; i++) {
+        input[i] = left[0][i];
+        input[Digest::LEN + i] = right[0][i];
+    }
+    EXPECT_EQ(cache.hash_10(input), Tip5::hash_10(input));
+    EXPECT_EQ(cache.stats().hits, 101u);
+
+    cache.reset_stats();
+    EXPECT_EQ(cache.stats().hits + cache.stats().misses, 0u);
+    cache.clear();
+    cache.hash_pair(left[0], right[0]);
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+TEST_F(HashCacheTest, BatchHashesOnlyMisses) {
+    HashCache cache(1 << 20, 4);
+    auto left = rng.random_digests(37);
+    auto right = rng.random_digests(37);
+    for (size_t i = 0; i < 10; i++) {
+        cache.hash_pair(left[i], right[i]);
+    }
+    cache.reset_stats();
+
+    std::vector<Digest> out(left.size());
+    cache.hash_pair_batch(left.data(), right.data(), out.data(), out.size());
+    for (size_t i = 0; i < out.size(); i++) {
+        ASSERT_EQ(out[i], Tip5::hash_pair(left[i], right[i]));
+    }
+    EXPECT_EQ(cache.stats().hits, 10u);
+    EXPECT_EQ(cache.stats().misses, 27u);
+}
+
+TEST_F(HashCacheTest, MemoryBudgetBoundsEntries) {
+    HashCache tiny(0, 2);
+    EXPECT_EQ(tiny.capacity(), 2 * HashCache::WAYS);
+    HashCache cache(64 << 10, 4);
+    EXPECT_LE(cache.capacity() * sizeof(Digest) * 3, size_t{64} << 10);
+
+    // Many more distinct inputs than entries: still correct, and a hot
+    // pair used between every insertion stays cached
+    Digest hot_left = rng.random_digest();
+    Digest hot_right = rng.random_digest();
+    cache.hash_pair(hot_left, hot_right);
+    cache.reset_stats();
+    for (size_t i = 0; i < 4 * cache.capacity(); i++) {
+        Digest a = rng.random_digest();
+        ASSERT_EQ(cache.hash_pair(a, a), Tip5::hash_pair(a, a));
+        ASSERT_EQ(cache.hash_pair(hot_left, hot_right), Tip5::hash_pair(hot_left, hot_right));
+    }
+    EXPECT_EQ(cache.stats().hits, 4 * cache.capacity());
+}
+
+TEST_F(HashCacheTest, ConcurrentUse) {
+    // About 4000 sets for 63 pairs, so no three of them are likely to
+    // share a 2-way set and evict each other
+    HashCache cache(1 << 20, 4);
+    auto inputs = rng.random_digests(64);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; t++) {
+        threads.emplace_back([&cache, &inputs]() {
+            for (size_t round = 0; round < 20; round++) {
+                for (size_t i = 0; i + 1 < inputs.size(); i++) {
+                    EXPECT_EQ(cache.hash_pair(inputs[i], inputs[i + 1]), Tip5::hash_pair(inputs[i], inputs[i + 1]));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 4u * 20 * 63);
+    EXPECT_GT(stats.hit_rate(), 0.9);
+}
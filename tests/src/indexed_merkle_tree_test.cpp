@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <set>
+#include <gtest/gtest.h>
+#include "tip5xx/indexed_merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class IndexedMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    // Rebuild the commitment from the tree's leaves
+    static Digest expected_root(const IndexedMerkleTree& tree) {
+        std::vector<Digest> leaves(tree.capacity());
+        for (size_t i = 0; i <= tree.size(); i++) {
+            leaves[i] = tree.leaf(i).digest();
+        }
+        return MerkleTree::build(leaves).root();
+    }
+};
+
+TEST_F(IndexedMerkleTreeTest, LeavesFormSortedList) {
+    IndexedMerkleTree tree(64);
+    std::set<uint64_t> values;
+    for (size_t k = 0; k < 40; k++) {
+        uint64_t value = rng.random_range<uint64_t>(1, BFieldElement::MAX_VALUE);
+        values.insert(value);
+        tree.insert(value);
+    }
+    EXPECT_EQ(tree.size(), values.size());
+    EXPECT_EQ(tree.root(), expected_root(tree));
+
+    // Walking the list from the reserved leaf 0 visits the values in order
+    size_t index = 0;
+    for (uint64_t value : values) {
+        EXPECT_EQ(tree.leaf(index).next_value, value);
+        index = tree.leaf(index).next_index;
+        EXPECT_EQ(tree.leaf(index).value, value);
+    }
+    EXPECT_EQ(tree.leaf(index).next_value, 0u);
+}
+
+TEST_F(IndexedMerkleTreeTest, MembershipAndNonMembershipProofs) {
+    IndexedMerkleTree tree(16);
+    tree.insert({100, 30, 70});
+    const Digest root = tree.root();
+    const size_t height = tree.height();
+
+    for (uint64_t value : {30, 70, 100}) {
+        auto proof = tree.prove(value);
+        EXPECT_EQ(proof.authentication_path.size(), tree.height());
+        EXPECT_TRUE(proof.verify_membership(root, height, value));
+        EXPECT_FALSE(proof.verify_non_membership(root, height, value));
+    }
+    for (uint64_t value : std::vector<uint64_t>{1, 29, 31, 99, 101, BFieldElement::MAX_VALUE}) {
+        auto proof = tree.prove(value);
+        EXPECT_TRUE(proof.verify_non_membership(root, height, value));
+        EXPECT_FALSE(proof.verify_membership(root, height, value));
+    }
+
+    // The low leaf of 50 does not cover 80, and proofs are bound to the root
+    auto proof = tree.prove(50);
+    EXPECT_FALSE(proof.verify_non_membership(root, height, 80));
+    EXPECT_FALSE(proof.verify_non_membership(rng.random_digest(), height, 50));
+    proof.leaf.next_value = 90;
+    EXPECT_FALSE(proof.verify_non_membership(root, height, 80));
+
+    // A path cut short reaches an inner node, which is no root of the tree
+    proof = tree.prove(50);
+    EXPECT_FALSE(proof.verify_non_membership(root, height + 1, 50));
+    Digest inner = proof.leaf.digest();
+    uint64_t node_index = proof.leaf_index;
+    for (size_t i = 0; i + 1 < proof.authentication_path.size(); i++, node_index /= 2) {
+        const Digest& sibling = proof.authentication_path[i];
+        inner = (node_index & 1) ? Tip5::hash_pair(sibling, inner) : Tip5::hash_pair(inner, sibling);
+    }
+    proof.authentication_path.pop_back();
+    proof.leaf_index %= tree.capacity() / 2;
+    EXPECT_FALSE(proof.verify_non_membership(inner, height, 50));
+    EXPECT_TRUE(proof.verify_non_membership(inner, height - 1, 50));
+}
+
+TEST_F(IndexedMerkleTreeTest, BatchInsertMatchesSingleInserts) {
+    std::vector<uint64_t> values;
+    for (size_t k = 0; k < 100; k++) {
+        values.push_back(rng.random_range<uint64_t>(1, 1000000) * 1000 + k);
+    }
+
+    IndexedMerkleTree batched(128);
+    IndexedMerkleTree single(128);
+    auto indices = batched.insert(values);
+    for (size_t k = 0; k < values.size(); k++) {
+        EXPECT_EQ(single.insert(values[k]), indices[k]);
+    }
+    EXPECT_EQ(batched.root(), single.root());
+    EXPECT_EQ(batched.root(), expected_root(batched));
+}
+
+TEST_F(IndexedMerkleTreeTest, RejectsBadValuesWithoutChanges) {
+    IndexedMerkleTree tree(4);
+    tree.insert(5);
+    const Digest root = tree.root();
+
+    EXPECT_THROW(tree.insert(uint64_t{0}), MerkleTreeError);
+    EXPECT_THROW(tree.insert(BFieldElement::P), MerkleTreeError);
+    EXPECT_THROW(tree.insert(5), MerkleTreeError);
+    EXPECT_THROW(tree.insert({6, 7, 6}), MerkleTreeError);
+    EXPECT_THROW(tree.insert({6, 7, 8}), MerkleTreeError);
+    EXPECT_EQ(tree.root(), root);
+    EXPECT_EQ(tree.size(), 1u);
+
+    tree.insert({6, 7});
+    EXPECT_THROW(tree.insert(8), MerkleTreeError);
+    EXPECT_THROW(IndexedMerkleTree(1), MerkleTreeError);
+    EXPECT_THROW(IndexedMerkleTree(6), MerkleTreeError);
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/low_degree_extension.hpp"
+#include "tip5xx/polynomial.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class LowDegreeExtensionTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    // Values of the polynomial on offset * <omega_length>
+    static std::vector<BFieldElement> evaluate_on_coset(const Polynomial& polynomial, size_t length,
+                                                        const BFieldElement& offset) {
+        BFieldElement omega = BFieldElement::primitive_root_of_unity(length);
+        std::vector<BFieldElement> points;
+        BFieldElement point = offset;
+        for (size_t i = 0; i < length; i++) {
+            points.push_back(point);
+            point *= omega;
+        }
+        return polynomial.evaluate(points);
+    }
+
+    // Column-major trace and extension of random polynomials of degree below n
+    void check(size_t n, size_t expansion_factor, size_t num_columns, const BFieldElement& extension_offset,
+               const BFieldElement& trace_offset, ThreadPool& pool) {
+        std::vector<BFieldElement> trace, expected;
+        for (size_t c = 0; c < num_columns; c++) {
+            Polynomial polynomial(rng.random_elements(n));
+            auto column = evaluate_on_coset(polynomial, n, trace_offset);
+            auto extension = evaluate_on_coset(polynomial, n * expansion_factor, extension_offset);
+            trace.insert(trace.end(), column.begin(), column.end());
+            expected.insert(expected.end(), extension.begin(), extension.end());
+        }
+        LowDegreeExtension lde(n, expansion_factor, extension_offset, trace_offset);
+        ASSERT_EQ(lde.extend(trace, pool), expected)
+            << n << " x " << expansion_factor << ", " << num_columns << " columns";
+    }
+};
+
+TEST_F(LowDegreeExtensionTest, MatchesPolynomialEvaluation) {
+    ThreadPool pool(4);
+    for (size_t n : {1u, 2u, 8u, 64u}) {
+        for (size_t expansion_factor : {1u, 2u, 8u}) {
+            check(n, expansion_factor, 6, BFieldElement::generator(), BFieldElement::one(), pool);
+        }
+    }
+}
+
+TEST_F(LowDegreeExtensionTest, SupportsTraceCosetsAndFewColumns) {
+    ThreadPool pool(4);
+    check(32, 4, 5, BFieldElement::generator(), BFieldElement::new_element(3), pool);
+
+    // Fewer columns than threads, and long enough for the four-step Ntt
+    LowDegreeExtension lde(1 << 16, 2);
+    auto trace = rng.random_elements(2 << 16);
+    auto batch = lde.extend(trace, pool);
+    std::vector<BFieldElement> extension(lde.extension_length());
+    for (size_t c = 0; c < 2; c++) {
+        lde.extend_column(trace.data() + (c << 16), extension.data());
+        ASSERT_TRUE(std::equal(extension.begin(), extension.end(), batch.begin() + c * lde.extension_length()));
+    }
+}
+
+TEST_F(LowDegreeExtensionTest, ExtendColumnMatchesBatch) {
+    LowDegreeExtension lde(128, 4);
+    auto trace = rng.random_elements(3 * 128);
+    auto batch = lde.extend(trace);
+    std::vector<BFieldElement> extension(lde.extension_length());
+    for (size_t c = 0; c < 3; c++) {
+        lde.extend_column(trace.data() + c * 128, extension.data());
+        ASSERT_TRUE(std::equal(extension.begin(), extension.end(), batch.begin() + c * lde.extension_length()));
+    }
+    EXPECT_EQ(lde.extension_length(), 512u);
+}
+
+TEST_F(LowDegreeExtensionTest, RejectsInvalidShapes) {
+    EXPECT_THROW(LowDegreeExtension(48, 4), NttError);
+    EXPECT_THROW(LowDegreeExtension(64, 3), NttError);
+    EXPECT_THROW(LowDegreeExtension(1 << 20, 1 << 12), NttError);
+    LowDegreeExtension lde(64, 2);
+    EXPECT_THROW(lde.extend(rng.random_elements(100)), NttError);
+    EXPECT_TRUE(lde.extend({}).empty());
+}
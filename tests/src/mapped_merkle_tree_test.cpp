@@ -0,0 +1,140 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <gtest/gtest.h>
+#include "tip5xx/mapped_merkle_tree.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MappedMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+    std::filesystem::path dir;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() /
+              ("tip5xx_mapped_" + std::to_string(rng.random_range<uint64_t>(1, UINT64_MAX)));
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+
+    std::string write_leaves(const std::vector<Digest>& leaves) {
+        auto path = (dir / "leaves.bin").string();
+        std::ofstream out(path, std::ios::binary);
+        for (const auto& leaf : leaves) {
+            auto bytes = leaf.to_bytes();
+            out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        }
+        return path;
+    }
+};
+
+TEST_F(MappedMerkleTreeTest, MatchesInMemoryTree) {
+    for (size_t log_n : {0, 1, 4, 9}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        auto tree_path = (dir / "tree.bin").string();
+
+        // Small tiles force several streaming passes over the tree file
+        ThreadPool pool(2);
+        MappedMerkleTree::build(write_leaves(leaves), tree_path, pool, 3);
+
+        auto expected = MerkleTree::build(leaves);
+        auto mapped = MappedMerkleTree::open(tree_path);
+        EXPECT_EQ(std::filesystem::file_size(tree_path), MappedMerkleTree::file_size(leaves.size()));
+        EXPECT_EQ(mapped.num_leaves(), leaves.size());
+        EXPECT_EQ(mapped.height(), log_n);
+        EXPECT_EQ(mapped.root(), expected.root());
+
+        for (size_t i = 0; i < leaves.size(); i += 3) {
+            EXPECT_EQ(mapped.leaf(i), leaves[i]);
+            EXPECT_EQ(mapped.authentication_path(i), expected.authentication_path(i));
+        }
+    }
+}
+
+TEST_F(MappedMerkleTreeTest, DefaultTileHeight) {
+    auto leaves = rng.random_digests(1 << 6);
+    auto tree_path = (dir / "tree.bin").string();
+    MappedMerkleTree::build(write_leaves(leaves), tree_path);
+    EXPECT_EQ(MappedMerkleTree::open(tree_path).root(), MerkleTree::build(leaves).root());
+}
+
+TEST_F(MappedMerkleTreeTest, RejectsNonCanonicalDigests) {
+    auto expect_invalid_file = [](auto&& call) {
+        try {
+            call();
+            FAIL() << "Expected MerkleTreeError";
+        } catch (const MerkleTreeError& e) {
+            EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidFile);
+        }
+    };
+    // The first element of leaf 1 becomes 2^64 - 1, above the modulus
+    auto corrupt = [](const std::string& path, uint64_t offset) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        const std::string ones(BFieldElement::BYTES, '\xff');
+        file.write(ones.data(), ones.size());
+    };
+
+    auto leaves_path = write_leaves(rng.random_digests(4));
+    auto tree_path = (dir / "tree.bin").string();
+    MappedMerkleTree::build(leaves_path, tree_path);
+    corrupt(tree_path, MappedMerkleTree::HEADER_SIZE + Digest::BYTES);
+    auto tree = MappedMerkleTree::open(tree_path);
+    EXPECT_NO_THROW(tree.leaf(2));
+    expect_invalid_file([&] { tree.leaf(1); });
+    expect_invalid_file([&] { tree.authentication_path(0); });
+
+    corrupt(leaves_path, Digest::BYTES);
+    expect_invalid_file([&] { MappedMerkleTree::build(leaves_path, (dir / "tree2.bin").string()); });
+}
+
+TEST_F(MappedMerkleTreeTest, RejectsBadInput) {
+    auto tree_path = (dir / "tree.bin").string();
+    EXPECT_THROW(MappedMerkleTree::build(write_leaves(rng.random_digests(3)), tree_path), MerkleTreeError);
+    EXPECT_THROW(MappedMerkleTree::build((dir / "missing.bin").string(), tree_path), MerkleTreeError);
+
+    // A leaves file is not a tree file
+    auto leaves_path = write_leaves(rng.random_digests(4));
+    EXPECT_THROW(MappedMerkleTree::open(leaves_path), MerkleTreeError);
+
+    MappedMerkleTree::build(leaves_path, tree_path);
+    auto tree = MappedMerkleTree::open(tree_path);
+    EXPECT_THROW(tree.leaf(4), MerkleTreeError);
+    EXPECT_THROW(tree.authentication_path(4), MerkleTreeError);
+    for (auto [level, index] : {std::pair<size_t, uint64_t>{1, 2}, {3, 0}}) {
+        try {
+            tree.node(level, index);
+            FAIL() << "Expected MerkleTreeError";
+        } catch (const MerkleTreeError& e) {
+            EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidArgument);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_batch_verifier.hpp"
+#include "tip5xx/merkle_tree.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MerkleBatchVerifierTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    MerkleInclusionClaim claim_for(const MerkleTree& tree, size_t leaf_index) {
+        return {tree.root(), tree.height(), leaf_index, tree.leaf(leaf_index), tree.authentication_path(leaf_index)};
+    }
+};
+
+TEST_F(MerkleBatchVerifierTest, EmptyBatch) {
+    EXPECT_TRUE(MerkleBatchVerifier::verify({}).empty());
+}
+
+TEST_F(MerkleBatchVerifierTest, ValidClaimsFromTreesOfDifferentHeights) {
+    std::vector<MerkleTree> trees;
+    for (size_t log_n : {0, 1, 3, 6, 9}) {
+        trees.push_back(MerkleTree::build(rng.random_digests(size_t{1} << log_n)));
+    }
+
+    std::vector<MerkleInclusionClaim> claims;
+    for (size_t i = 0; i < 100; i++) {
+        const auto& tree = trees[i % trees.size()];
+        claims.push_back(claim_for(tree, rng.random_range<size_t>(tree.num_leaves() - 1)));
+    }
+
+    auto result = MerkleBatchVerifier::verify(claims);
+    ASSERT_EQ(result.size(), claims.size());
+    for (size_t i = 0; i < claims.size(); i++) {
+        EXPECT_TRUE(result[i]) << "claim " << i;
+    }
+}
+
+TEST_F(MerkleBatchVerifierTest, FailuresAreReportedPerClaim) {
+    auto tree = MerkleTree::build(rng.random_digests(1 << 7));
+
+    std::vector<MerkleInclusionClaim> claims;
+    for (size_t i = 0; i < 20; i++) {
+        claims.push_back(claim_for(tree, i * 5));
+    }
+    claims[2].leaf = rng.random_digest();
+    claims[5].leaf_index ^= 1;
+    claims[11].authentication_path.pop_back();
+    claims[13].authentication_path[3] = rng.random_digest();
+    claims[17].root = rng.random_digest();
+    claims[19].leaf_index = 1 << 7;
+
+    auto result = MerkleBatchVerifier::verify(claims);
+    for (size_t i = 0; i < claims.size(); i++) {
+        bool tampered = i == 2 || i == 5 || i == 11 || i == 13 || i == 17 || i == 19;
+        EXPECT_EQ(result[i], !tampered) << "claim " << i;
+        EXPECT_EQ(result[i], MerkleTree::verify_authentication_path(
+            claims[i].root, claims[i].tree_height, claims[i].leaf_index,
+            claims[i].leaf, claims[i].authentication_path));
+    }
+}
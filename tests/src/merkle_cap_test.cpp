@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_cap.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MerkleCapTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(MerkleCapTest, TruncatedPathsVerifyAgainstCap) {
+    const size_t log_n = 6;
+    auto leaves = rng.random_digests(size_t{1} << log_n);
+    auto tree = MerkleTree::build(leaves);
+
+    for (size_t cap_height = 0; cap_height <= log_n; cap_height++) {
+        auto cap = MerkleCap::from_tree(tree, cap_height);
+        EXPECT_EQ(cap.cap_height(), cap_height);
+        EXPECT_EQ(cap.digests().size(), size_t{1} << cap_height);
+        EXPECT_EQ(cap.root(), tree.root());
+
+        for (size_t i = 0; i < leaves.size(); i++) {
+            auto path = MerkleCap::authentication_path(tree, cap_height, i);
+            ASSERT_EQ(path.size(), log_n - cap_height);
+            ASSERT_TRUE(cap.verify(i, leaves[i], path));
+            ASSERT_FALSE(cap.verify(i ^ 1, leaves[i], path) && leaves[i] != leaves[i ^ 1]);
+        }
+    }
+}
+
+TEST_F(MerkleCapTest, RejectsWrongProofs) {
+    auto leaves = rng.random_digests(32);
+    auto tree = MerkleTree::build(leaves);
+    auto cap = MerkleCap::from_tree(tree, 2);
+    auto path = MerkleCap::authentication_path(tree, 2, 5);
+
+    EXPECT_FALSE(cap.verify(5, rng.random_digest(), path));
+    EXPECT_FALSE(cap.verify(32, leaves[5], path));
+    // An uncapped path is too long
+    EXPECT_FALSE(cap.verify(5, leaves[5], tree.authentication_path(5)));
+    path[0] = rng.random_digest();
+    EXPECT_FALSE(cap.verify(5, leaves[5], path));
+
+    auto expect_invalid_argument = [](auto&& call) {
+        try {
+            call();
+            FAIL() << "Expected MerkleTreeError";
+        } catch (const MerkleTreeError& e) {
+            EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidArgument);
+        }
+    };
+    expect_invalid_argument([&] { MerkleCap::from_tree(tree, 6); });
+    expect_invalid_argument([&] { MerkleCap::authentication_path(tree, 6, 5); });
+    expect_invalid_argument([&] { MerkleCap(2, rng.random_digests(3)); });
+    expect_invalid_argument([&] { MerkleCap(2, rng.random_digests(8)); });
+}
+
+TEST_F(MerkleCapTest, SerializationRoundTrip) {
+    auto tree = MerkleTree::build(rng.random_digests(64));
+    auto cap = MerkleCap::from_tree(tree, 3);
+    auto bytes = cap.to_bytes();
+    EXPECT_EQ(bytes.size(), 8 + 8 * Digest::BYTES);
+
+    auto decoded = MerkleCap::from_bytes(bytes);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->tree_height(), cap.tree_height());
+    EXPECT_EQ(decoded->digests(), cap.digests());
+
+    EXPECT_FALSE(MerkleCap::from_bytes({}).has_value());
+    EXPECT_FALSE(MerkleCap::from_bytes(std::vector<uint8_t>(bytes.begin(), bytes.end() - 1)).has_value());
+    EXPECT_FALSE(MerkleCap::from_bytes(std::vector<uint8_t>(bytes.begin(), bytes.end() - Digest::BYTES)).has_value());
+    // Cap larger than the tree it claims to belong to
+    bytes[0] = 2;
+    EXPECT_FALSE(MerkleCap::from_bytes(bytes).has_value());
+}
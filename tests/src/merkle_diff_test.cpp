@@ -0,0 +1,113 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_diff.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MerkleDiffTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(MerkleDiffTest, DiffFindsChangedRanges) {
+    auto leaves = rng.random_digests(64);
+    auto a = MerkleTree::build(leaves);
+    EXPECT_TRUE(MerkleDiff::diff(a, a).empty());
+
+    for (size_t i : {3, 4, 5, 20, 63}) {
+        leaves[i] = rng.random_digest();
+    }
+    auto b = MerkleTree::build(leaves);
+    std::vector<LeafRange> expected = {{3, 6}, {20, 21}, {63, 64}};
+    EXPECT_EQ(MerkleDiff::diff(a, b), expected);
+    EXPECT_EQ(MerkleDiff::diff(b, a), expected);
+
+    try {
+        MerkleDiff::diff(a, MerkleTree::build(rng.random_digests(32)));
+        FAIL() << "Expected MerkleTreeError";
+    } catch (const MerkleTreeError& e) {
+        EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidArgument);
+    }
+}
+
+TEST_F(MerkleDiffTest, SyncReconcilesReplicas) {
+    const size_t log_n = 10;
+    auto remote_leaves = rng.random_digests(size_t{1} << log_n);
+    auto local_leaves = remote_leaves;
+    const size_t num_changes = 5;
+    for (size_t k = 0; k < num_changes; k++) {
+        local_leaves[rng.random_range(local_leaves.size() - 1)] = rng.random_digest();
+    }
+    auto remote = MerkleTree::build(remote_leaves);
+    auto local = MerkleTree::build(local_leaves);
+
+    // Both directions go through the wire format
+    MerkleSync sync(local);
+    size_t round_trips = 0;
+    size_t digests_sent = 0;
+    while (!sync.done()) {
+        auto request = MerkleSyncRequest::from_bytes(sync.request().to_bytes());
+        ASSERT_TRUE(request.has_value());
+        auto response = MerkleSyncResponse::from_bytes(MerkleSync::respond(remote, *request).to_bytes());
+        ASSERT_TRUE(response.has_value());
+        digests_sent += response->digests.size();
+        sync.receive(*response);
+        round_trips++;
+    }
+
+    EXPECT_LE(round_trips, log_n + 1);
+    EXPECT_LE(digests_sent, 1 + 2 * num_changes * log_n);
+    EXPECT_EQ(sync.differing_leaf_ranges(), MerkleDiff::diff(local, remote));
+    for (const auto& [leaf_index, leaf] : sync.differing_leaves()) {
+        EXPECT_EQ(leaf, remote_leaves[leaf_index]);
+    }
+
+    local.update(sync.differing_leaves());
+    EXPECT_EQ(local.root(), remote.root());
+}
+
+TEST_F(MerkleDiffTest, RejectsMalformedMessages) {
+    auto tree = MerkleTree::build(rng.random_digests(8));
+    MerkleSync sync(tree);
+    auto expect_invalid_argument = [](auto&& call) {
+        try {
+            call();
+            FAIL() << "Expected MerkleTreeError";
+        } catch (const MerkleTreeError& e) {
+            EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidArgument);
+        }
+    };
+    expect_invalid_argument([&] { MerkleSync::respond(tree, {4, {1}}); });
+    expect_invalid_argument([&] { MerkleSync::respond(tree, {8, {16}}); });
+    expect_invalid_argument([&] { MerkleSync::respond(tree, {8, {0}}); });
+    expect_invalid_argument([&] { sync.receive(MerkleSyncResponse{}); });
+
+    auto request_bytes = MerkleSyncRequest{8, {2, 3}}.to_bytes();
+    request_bytes.pop_back();
+    EXPECT_FALSE(MerkleSyncRequest::from_bytes(request_bytes).has_value());
+    auto response_bytes = MerkleSyncResponse{{tree.root()}}.to_bytes();
+    response_bytes[0] = 2;
+    EXPECT_FALSE(MerkleSyncResponse::from_bytes(response_bytes).has_value());
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_multi_proof.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MerkleMultiProofTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(MerkleMultiProofTest, SingleLeafProofEqualsAuthenticationPath) {
+    auto tree = MerkleTree::build(rng.random_digests(1 << 6));
+    auto proof = MerkleMultiProof::generate(tree, {13});
+    EXPECT_EQ(proof.authentication_structure, tree.authentication_path(13));
+    EXPECT_TRUE(proof.verify(tree.root()));
+}
+
+TEST_F(MerkleMultiProofTest, SharedSiblingsAreEmittedOnce) {
+    auto tree = MerkleTree::build(rng.random_digests(8));
+
+    // Leaves 0 and 1 are siblings, their parent's sibling is node 5, and
+    // the sibling of the common ancestor is node 3
+    auto node_indices = MerkleMultiProof::authentication_structure_node_indices(8, {0, 1});
+    EXPECT_EQ(node_indices, (std::vector<size_t>{5, 3}));
+
+    // Opening every leaf needs no siblings at all
+    node_indices = MerkleMultiProof::authentication_structure_node_indices(8, {7, 6, 5, 4, 3, 2, 1, 0});
+    EXPECT_TRUE(node_indices.empty());
+
+    // Leaves 0 and 2: siblings 9 and 11 at the bottom, then 3
+    node_indices = MerkleMultiProof::authentication_structure_node_indices(8, {2, 0, 2});
+    EXPECT_EQ(node_indices, (std::vector<size_t>{9, 11, 3}));
+}
+
+TEST_F(MerkleMultiProofTest, RandomOpeningsVerify) {
+    auto leaves = rng.random_digests(1 << 10);
+    auto tree = MerkleTree::build(leaves);
+
+    for (size_t num_opened : {1, 2, 17, 200, 1024}) {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < num_opened; i++) {
+            indices.push_back(rng.random_range<size_t>(leaves.size() - 1));
+        }
+        auto proof = MerkleMultiProof::generate(tree, indices);
+        EXPECT_TRUE(proof.verify(tree.root())) << num_opened << " leaves";
+
+        // Never larger than the individual paths combined
+        EXPECT_LE(proof.authentication_structure.size(), num_opened * tree.height());
+    }
+}
+
+TEST_F(MerkleMultiProofTest, TamperedProofsAreRejected) {
+    auto leaves = rng.random_digests(1 << 5);
+    auto tree = MerkleTree::build(leaves);
+    auto proof = MerkleMultiProof::generate(tree, {3, 9, 20});
+    ASSERT_TRUE(proof.verify(tree.root()));
+
+    auto bad_leaf = proof;
+    bad_leaf.indexed_leaves[1].second = rng.random_digest();
+    EXPECT_FALSE(bad_leaf.verify(tree.root()));
+
+    auto bad_index = proof;
+    bad_index.indexed_leaves[1].first = 10;
+    EXPECT_FALSE(bad_index.verify(tree.root()));
+
+    auto short_structure = proof;
+    short_structure.authentication_structure.pop_back();
+    EXPECT_FALSE(short_structure.verify(tree.root()));
+
+    auto long_structure = proof;
+    long_structure.authentication_structure.push_back(rng.random_digest());
+    EXPECT_FALSE(long_structure.verify(tree.root()));
+
+    auto conflicting_duplicate = proof;
+    conflicting_duplicate.indexed_leaves.emplace_back(3, rng.random_digest());
+    EXPECT_FALSE(conflicting_duplicate.verify(tree.root()));
+
+    EXPECT_FALSE(proof.verify(rng.random_digest()));
+}
+
+TEST_F(MerkleMultiProofTest, OutOfBoundsLeafIndexThrows) {
+    auto tree = MerkleTree::build(rng.random_digests(4));
+    EXPECT_THROW(MerkleMultiProof::generate(tree, {1, 4}), MerkleTreeError);
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <bitset>
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_root_builder.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MerkleRootBuilderTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(MerkleRootBuilderTest, RootMatchesMerkleTree) {
+    for (size_t log_n : {0, 1, 2, 7, 11}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        MerkleRootBuilder builder;
+        for (const auto& leaf : leaves) {
+            builder.push(leaf);
+            ASSERT_LE(builder.num_pending(), log_n + 1);
+        }
+        EXPECT_EQ(builder.num_leaves(), leaves.size());
+        EXPECT_EQ(builder.num_pending(), 1u);
+        EXPECT_EQ(builder.root(), MerkleTree::build(leaves).root());
+
+        MerkleRootBuilder bulk;
+        bulk.push(leaves.data(), leaves.size());
+        EXPECT_EQ(bulk.root(), builder.root());
+    }
+}
+
+TEST_F(MerkleRootBuilderTest, RejectsNumberOfLeavesThatIsNotPowerOfTwo) {
+    MerkleRootBuilder builder;
+    EXPECT_THROW(builder.root(), MerkleTreeError);
+    for (size_t n = 1; n <= 8; n++) {
+        builder.push(rng.random_digest());
+        if (MerkleTree::is_valid_num_leaves(n)) {
+            EXPECT_NO_THROW(builder.root());
+        } else {
+            EXPECT_THROW(builder.root(), MerkleTreeError);
+            // One pending subtree per set bit of the count
+            EXPECT_EQ(builder.num_pending(), std::bitset<64>(n).count());
+        }
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    // Reference root computed one level at a time on a single thread
+    static Digest naive_root(std::vector<Digest> level) {
+        while (level.size() > 1) {
+            std::vector<Digest> next;
+            for (size_t i = 0; i < level.size(); i += 2) {
+                next.push_back(Tip5::hash_pair(level[i], level[i + 1]));
+            }
+            level = next;
+        }
+        return level[0];
+    }
+};
+
+TEST_F(MerkleTreeTest, SingleLeafTreeHasLeafAsRoot) {
+    auto leaves = rng.random_digests(1);
+    auto tree = MerkleTree::build(leaves);
+    EXPECT_EQ(tree.root(), leaves[0]);
+    EXPECT_EQ(tree.height(), 0u);
+    EXPECT_TRUE(tree.authentication_path(0).empty());
+}
+
+TEST_F(MerkleTreeTest, RootMatchesNaiveConstruction) {
+    for (size_t log_n : {1, 2, 5, 10, 11, 13}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        auto tree = MerkleTree::build(leaves);
+        EXPECT_EQ(tree.root(), naive_root(leaves)) << "log_n = " << log_n;
+        EXPECT_EQ(tree.height(), log_n);
+        EXPECT_EQ(tree.num_leaves(), leaves.size());
+    }
+}
+
+TEST_F(MerkleTreeTest, RootIsIndependentOfThreadCount) {
+    auto leaves = rng.random_digests(1 << 12);
+    ThreadPool single(1);
+    ThreadPool several(4);
+    auto tree1 = MerkleTree::build(leaves, single);
+    auto tree4 = MerkleTree::build(leaves, several);
+    EXPECT_EQ(tree1.nodes(), tree4.nodes());
+}
+
+TEST_F(MerkleTreeTest, RejectsNumberOfLeavesThatIsNotPowerOfTwo) {
+    for (size_t n : {0, 3, 6, 1000}) {
+        auto leaves = rng.random_digests(n);
+        try {
+            MerkleTree::build(leaves);
+            FAIL() << "Expected MerkleTreeError for " << n << " leaves";
+        } catch (const MerkleTreeError& e) {
+            EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::IncorrectNumberOfLeaves);
+        }
+    }
+}
+
+TEST_F(MerkleTreeTest, AuthenticationPathsVerify) {
+    auto leaves = rng.random_digests(1 << 8);
+    auto tree = MerkleTree::build(leaves);
+
+    for (size_t i = 0; i < leaves.size(); i += 7) {
+        auto path = tree.authentication_path(i);
+        EXPECT_EQ(path.size(), tree.height());
+        EXPECT_TRUE(MerkleTree::verify_authentication_path(tree.root(), tree.height(), i, leaves[i], path));
+
+        // Wrong leaf, index or path must be rejected
+        EXPECT_FALSE(MerkleTree::verify_authentication_path(tree.root(), tree.height(), i, leaves[i ^ 1], path));
+        EXPECT_FALSE(MerkleTree::verify_authentication_path(tree.root(), tree.height(), i ^ 1, leaves[i], path));
+        path.pop_back();
+        EXPECT_FALSE(MerkleTree::verify_authentication_path(tree.root(), tree.height(), i, leaves[i], path));
+    }
+}
+
+TEST_F(MerkleTreeTest, LeafIndexOutOfBoundsThrows) {
+    auto tree = MerkleTree::build(rng.random_digests(4));
+    EXPECT_THROW(tree.leaf(4), MerkleTreeError);
+    EXPECT_THROW(tree.authentication_path(4), MerkleTreeError);
+}
+
+TEST_F(MerkleTreeTest, UpdateMatchesRebuild) {
+    for (size_t log_n : {0, 1, 4, 9}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        auto tree = MerkleTree::build(leaves);
+
+        std::vector<std::pair<size_t, Digest>> updates;
+        for (size_t k = 0; k < 3 + leaves.size() / 8; k++) {
+            updates.emplace_back(rng.random_range(leaves.size() - 1), rng.random_digest());
+        }
+        // Repeated indices: the last update wins
+        updates.emplace_back(updates.front().first, rng.random_digest());
+        for (const auto& [leaf_index, digest] : updates) {
+            leaves[leaf_index] = digest;
+        }
+
+        tree.update(updates);
+        EXPECT_EQ(tree.nodes(), MerkleTree::build(leaves).nodes());
+    }
+}
+
+TEST_F(MerkleTreeTest, UpdateWithBadIndexLeavesTreeUntouched) {
+    auto leaves = rng.random_digests(8);
+    auto tree = MerkleTree::build(leaves);
+    EXPECT_THROW(tree.update({{0, rng.random_digest()}, {8, rng.random_digest()}}), MerkleTreeError);
+    EXPECT_EQ(tree.nodes(), MerkleTree::build(leaves).nodes());
+    tree.update({});
+    EXPECT_EQ(tree.root(), MerkleTree::build(leaves).root());
+}
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallel_for(0, visits.size(), [&visits](size_t i) { visits[i]++; });
+    for (const auto& v : visits) {
+        EXPECT_EQ(v.load(), 1);
+    }
+}
+
+TEST(ThreadPoolTest, ParallelForPropagatesExceptions) {
+    ThreadPool pool(3);
+    EXPECT_THROW(pool.parallel_for(0, 100, [](size_t i) {
+        if (i == 42) throw std::runtime_error("boom");
+    }), std::runtime_error);
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/mmr.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class MmrTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(MmrTest, EmptyAccumulator) {
+    MmrAccumulator acc;
+    EXPECT_EQ(acc.num_leaves(), 0u);
+    EXPECT_TRUE(acc.peaks().empty());
+    EXPECT_EQ(acc.bag_peaks(), ArchivalMmr().bag_peaks());
+}
+
+TEST_F(MmrTest, PowerOfTwoLeavesHaveSinglePeakEqualToMerkleRoot) {
+    auto leaves = rng.random_digests(64);
+    MmrAccumulator acc;
+    for (const auto& leaf : leaves) {
+        acc.append(leaf);
+    }
+    ASSERT_EQ(acc.peaks().size(), 1u);
+    EXPECT_EQ(acc.peaks()[0], MerkleTree::build(leaves).root());
+}
+
+TEST_F(MmrTest, PeaksFollowBinaryRepresentationOfLeafCount) {
+    auto leaves = rng.random_digests(13);   // 8 + 4 + 1
+    ArchivalMmr mmr;
+    for (const auto& leaf : leaves) {
+        mmr.append(leaf);
+    }
+
+    auto peaks = mmr.peaks();
+    ASSERT_EQ(peaks.size(), 3u);
+    EXPECT_EQ(peaks[0], MerkleTree::build({leaves.begin(), leaves.begin() + 8}).root());
+    EXPECT_EQ(peaks[1], MerkleTree::build({leaves.begin() + 8, leaves.begin() + 12}).root());
+    EXPECT_EQ(peaks[2], leaves[12]);
+}
+
+TEST_F(MmrTest, AccumulatorAndArchivalMmrAgree) {
+    MmrAccumulator acc;
+    ArchivalMmr mmr;
+    for (size_t i = 0; i < 100; i++) {
+        auto leaf = rng.random_digest();
+        acc.append(leaf);
+        mmr.append(leaf);
+        ASSERT_EQ(acc.peaks(), mmr.peaks()) << i;
+        ASSERT_EQ(acc.bag_peaks(), mmr.bag_peaks()) << i;
+    }
+}
+
+TEST_F(MmrTest, MembershipProofsVerify) {
+    ArchivalMmr mmr;
+    auto leaves = rng.random_digests(77);
+    for (const auto& leaf : leaves) {
+        mmr.append(leaf);
+    }
+
+    auto acc = mmr.accumulator();
+    for (uint64_t i = 0; i < leaves.size(); i++) {
+        auto proof = mmr.prove(i);
+        EXPECT_TRUE(acc.verify(leaves[i], proof)) << i;
+        EXPECT_FALSE(acc.verify(leaves[(i + 1) % leaves.size()], proof)) << i;
+    }
+    EXPECT_THROW(mmr.prove(leaves.size()), MerkleTreeError);
+}
+
+TEST_F(MmrTest, ProofsStayValidAcrossAppends) {
+    ArchivalMmr mmr;
+    std::vector<Digest> leaves;
+    std::vector<MmrMembershipProof> proofs;
+
+    for (size_t i = 0; i < 70; i++) {
+        auto old_acc = mmr.accumulator();
+        auto leaf = rng.random_digest();
+        for (auto& proof : proofs) {
+            proof.update_from_append(old_acc.num_leaves(), leaf, old_acc.peaks());
+        }
+
+        mmr.append(leaf);
+        leaves.push_back(leaf);
+        proofs.push_back(mmr.prove(i));
+
+        auto acc = mmr.accumulator();
+        for (size_t j = 0; j < proofs.size(); j++) {
+            ASSERT_TRUE(acc.verify(leaves[j], proofs[j])) << "leaf " << j << " after " << i + 1 << " appends";
+            ASSERT_EQ(proofs[j].authentication_path, mmr.prove(j).authentication_path);
+        }
+    }
+}
+
+TEST_F(MmrTest, PeaksRoundTripThroughBytes) {
+    MmrAccumulator acc;
+    for (const auto& leaf : rng.random_digests(21)) {
+        acc.append(leaf);
+    }
+
+    auto bytes = acc.to_bytes();
+    EXPECT_EQ(bytes.size(), 8 + 3 * Digest::BYTES);
+
+    auto restored = MmrAccumulator::from_bytes(bytes);
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->num_leaves(), acc.num_leaves());
+    EXPECT_EQ(restored->peaks(), acc.peaks());
+
+    // Appending to the restored accumulator continues where the original stopped
+    auto leaf = rng.random_digest();
+    acc.append(leaf);
+    restored->append(leaf);
+    EXPECT_EQ(restored->bag_peaks(), acc.bag_peaks());
+
+    bytes.pop_back();
+    EXPECT_FALSE(MmrAccumulator::from_bytes(bytes).has_value());
+}
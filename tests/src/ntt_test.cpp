@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/ntt.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class NttTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    // f(omega^i) by Horner's rule
+    static std::vector<BFieldElement> naive_forward(const std::vector<BFieldElement>& coefficients) {
+        BFieldElement omega = BFieldElement::primitive_root_of_unity(coefficients.size());
+        BFieldElement x = BFieldElement::one();
+        std::vector<BFieldElement> values;
+        for (size_t i = 0; i < coefficients.size(); i++) {
+            BFieldElement value = BFieldElement::zero();
+            for (auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+                value = value * x + *it;
+            }
+            values.push_back(value);
+            x *= omega;
+        }
+        return values;
+    }
+};
+
+TEST_F(NttTest, MatchesNaiveEvaluation) {
+    for (size_t log_length = 0; log_length <= 9; log_length++) {
+        auto coefficients = rng.random_elements(size_t{1} << log_length);
+        auto values = coefficients;
+        Ntt::forward(values);
+        ASSERT_EQ(values, naive_forward(coefficients)) << "length 2^" << log_length;
+    }
+}
+
+TEST_F(NttTest, InverseUndoesForward) {
+    for (size_t log_length : {1u, 2u, 7u, 12u, 13u, 16u}) {
+        auto coefficients = rng.random_elements(size_t{1} << log_length);
+        auto values = coefficients;
+        Ntt::forward(values);
+        Ntt::inverse(values);
+        ASSERT_EQ(values, coefficients) << "length 2^" << log_length;
+    }
+}
+
+TEST_F(NttTest, FourStepMatchesFlatTransform) {
+    ThreadPool pool(4);
+    for (size_t log_length : {Ntt::FOUR_STEP_MIN_LOG_LENGTH, Ntt::FOUR_STEP_MIN_LOG_LENGTH + 1}) {
+        auto coefficients = rng.random_elements(size_t{1} << log_length);
+        auto flat = coefficients;
+        auto four_step = coefficients;
+        Ntt::forward(flat);
+        Ntt::forward(four_step, pool);
+        ASSERT_EQ(four_step, flat) << "length 2^" << log_length;
+
+        Ntt::inverse(four_step, pool);
+        ASSERT_EQ(four_step, coefficients) << "length 2^" << log_length;
+    }
+}
+
+TEST_F(NttTest, TransformsConstantsAndMonomials) {
+    std::vector<BFieldElement> values(1024, BFieldElement::zero());
+    values[0] = BFieldElement::new_element(5);
+    Ntt::forward(values);
+    EXPECT_EQ(values, std::vector<BFieldElement>(1024, BFieldElement::new_element(5)));
+
+    // x -> omega^i
+    std::fill(values.begin(), values.end(), BFieldElement::zero());
+    values[1] = BFieldElement::one();
+    Ntt::forward(values);
+    EXPECT_EQ(values, BFieldElement::primitive_root_of_unity(1024).cyclic_group_elements());
+}
+
+TEST_F(NttTest, BitReversalPermutes) {
+    // Below and above the size at which the tiled permutation takes over
+    for (size_t log_length : {3u, 11u, 12u, 15u}) {
+        size_t length = size_t{1} << log_length;
+        std::vector<BFieldElement> values;
+        for (size_t i = 0; i < length; i++) {
+            values.push_back(BFieldElement::new_element(i));
+        }
+        Ntt::bit_reverse(values.data(), length);
+        for (size_t i = 0; i < length; i++) {
+            size_t reversed = 0;
+            for (size_t bit = 0; bit < log_length; bit++) {
+                reversed |= ((i >> bit) & 1) << (log_length - 1 - bit);
+            }
+            ASSERT_EQ(values[i].value(), reversed) << "length 2^" << log_length;
+        }
+    }
+}
+
+TEST_F(NttTest, RejectsInvalidLengths) {
+    std::vector<BFieldElement> values(12);
+    EXPECT_THROW(Ntt::forward(values), NttError);
+    values.clear();
+    EXPECT_THROW(Ntt::inverse(values), NttError);
+    EXPECT_FALSE(Ntt::is_valid_length(size_t{1} << 31));
+    EXPECT_TRUE(Ntt::is_valid_length(size_t{1} << 30));
+}
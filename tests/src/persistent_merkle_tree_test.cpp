@@ -0,0 +1,116 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/persistent_merkle_tree.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class PersistentMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    std::vector<std::pair<size_t, Digest>> random_updates(size_t num_leaves, size_t count) {
+        std::vector<std::pair<size_t, Digest>> updates;
+        for (size_t k = 0; k < count; k++) {
+            updates.emplace_back(rng.random_range(num_leaves - 1), rng.random_digest());
+        }
+        return updates;
+    }
+};
+
+TEST_F(PersistentMerkleTreeTest, EveryVersionMatchesRebuild) {
+    for (size_t log_n : {0, 1, 6}) {
+        std::vector<std::vector<Digest>> history = {rng.random_digests(size_t{1} << log_n)};
+        PersistentMerkleTree tree(history[0]);
+
+        for (size_t v = 1; v <= 4; v++) {
+            auto updates = random_updates(history[0].size(), 1 + v);
+            history.push_back(history.back());
+            for (const auto& [leaf_index, digest] : updates) {
+                history.back()[leaf_index] = digest;
+            }
+            EXPECT_EQ(tree.update(updates), v);
+        }
+
+        EXPECT_EQ(tree.latest_version(), 4u);
+        for (uint64_t v = 0; v < history.size(); v++) {
+            auto expected = MerkleTree::build(history[v]);
+            ASSERT_EQ(tree.root(v), expected.root());
+            for (size_t i = 0; i < history[v].size(); i++) {
+                ASSERT_EQ(tree.leaf(v, i), history[v][i]);
+                ASSERT_EQ(tree.authentication_path(v, i), expected.authentication_path(i));
+            }
+        }
+    }
+}
+
+TEST_F(PersistentMerkleTreeTest, VersionsShareUnchangedNodes) {
+    const size_t num_leaves = 1024;
+    PersistentMerkleTree tree(rng.random_digests(num_leaves));
+    EXPECT_EQ(tree.num_stored_nodes(), 2 * num_leaves - 1);
+
+    // One changed leaf copies exactly one root-to-leaf path
+    tree.update({{17, rng.random_digest()}});
+    EXPECT_EQ(tree.num_stored_nodes(), 2 * num_leaves - 1 + tree.height() + 1);
+
+    // An empty update is a new version of the same tree
+    uint64_t same = tree.update({});
+    EXPECT_EQ(tree.root(same), tree.root(same - 1));
+    EXPECT_EQ(tree.num_stored_nodes(), 2 * num_leaves - 1 + tree.height() + 1);
+}
+
+TEST_F(PersistentMerkleTreeTest, ReleasedVersionsAreCollected) {
+    const size_t num_leaves = 256;
+    PersistentMerkleTree tree(rng.random_digests(num_leaves));
+    for (size_t v = 0; v < 20; v++) {
+        tree.update(random_updates(num_leaves, 8));
+    }
+    size_t nodes_with_history = tree.num_stored_nodes();
+
+    tree.retain_last(1);
+    EXPECT_EQ(tree.versions(), std::vector<uint64_t>{20});
+    EXPECT_EQ(tree.num_stored_nodes(), 2 * num_leaves - 1);
+    EXPECT_LT(tree.num_stored_nodes(), nodes_with_history);
+    EXPECT_THROW(tree.root(3), MerkleTreeError);
+
+    // The newest tree stays the base for updates after its version is released
+    Digest latest_root = tree.root(20);
+    tree.release(20);
+    EXPECT_TRUE(tree.versions().empty());
+    EXPECT_EQ(tree.num_stored_nodes(), 2 * num_leaves - 1);
+    EXPECT_THROW(tree.release(20), MerkleTreeError);
+    uint64_t next = tree.update({});
+    EXPECT_EQ(next, 21u);
+    EXPECT_EQ(tree.root(next), latest_root);
+}
+
+TEST_F(PersistentMerkleTreeTest, BadIndexThrowsWithoutNewVersion) {
+    PersistentMerkleTree tree(rng.random_digests(8));
+    EXPECT_THROW(tree.update({{8, rng.random_digest()}}), MerkleTreeError);
+    EXPECT_EQ(tree.latest_version(), 0u);
+    EXPECT_THROW(tree.leaf(0, 8), MerkleTreeError);
+    EXPECT_THROW(tree.authentication_path(0, 8), MerkleTreeError);
+    EXPECT_THROW(PersistentMerkleTree(rng.random_digests(6)), MerkleTreeError);
+}
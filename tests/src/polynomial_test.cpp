@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/polynomial.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class PolynomialTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+
+    Polynomial random_polynomial(size_t num_coefficients) {
+        auto coefficients = rng.random_elements(num_coefficients);
+        if (num_coefficients > 0 && coefficients.back().is_zero()) {
+            coefficients.back() = BFieldElement::one();
+        }
+        return Polynomial(coefficients);
+    }
+
+    static Polynomial multiply_naive(const Polynomial& a, const Polynomial& b) {
+        if (a.is_zero() || b.is_zero()) {
+            return Polynomial();
+        }
+        std::vector<BFieldElement> product(a.coefficients().size() + b.coefficients().size() - 1);
+        for (size_t i = 0; i < a.coefficients().size(); i++) {
+            for (size_t j = 0; j < b.coefficients().size(); j++) {
+                product[i + j] += a.coefficients()[i] * b.coefficients()[j];
+            }
+        }
+        return Polynomial(product);
+    }
+};
+
+TEST_F(PolynomialTest, NormalizesAndReportsDegree) {
+    Polynomial zero({BFieldElement::zero(), BFieldElement::zero()});
+    EXPECT_TRUE(zero.is_zero());
+    EXPECT_EQ(zero.degree(), -1);
+    EXPECT_EQ(zero, Polynomial());
+
+    Polynomial p({BFieldElement::one(), BFieldElement::new_element(3), BFieldElement::zero()});
+    EXPECT_EQ(p.degree(), 1);
+    EXPECT_EQ(p.leading_coefficient(), BFieldElement::new_element(3));
+    EXPECT_EQ(p.evaluate(BFieldElement::new_element(2)), BFieldElement::new_element(7));
+    EXPECT_EQ(p.derivative(), Polynomial({BFieldElement::new_element(3)}));
+    EXPECT_TRUE((p - p).is_zero());
+}
+
+TEST_F(PolynomialTest, MultiplicationMatchesSchoolbook) {
+    // Below, at and above the NTT threshold, with unbalanced factors
+    for (auto [a_size, b_size] : std::vector<std::pair<size_t, size_t>>{
+             {1, 1}, {5, 17}, {63, 64}, {64, 64}, {200, 333}, {1000, 70}}) {
+        auto a = random_polynomial(a_size);
+        auto b = random_polynomial(b_size);
+        ASSERT_EQ(a * b, multiply_naive(a, b)) << a_size << " x " << b_size;
+    }
+    EXPECT_TRUE((random_polynomial(100) * Polynomial()).is_zero());
+}
+
+TEST_F(PolynomialTest, DivisionWithRemainder) {
+    for (auto [a_size, b_size] : std::vector<std::pair<size_t, size_t>>{
+             {10, 3}, {3, 10}, {300, 2}, {300, 150}, {1000, 200}, {1000, 800}, {2048, 1024}}) {
+        auto a = random_polynomial(a_size);
+        auto b = random_polynomial(b_size);
+        auto [quotient, remainder] = a.divide(b);
+        ASSERT_LT(remainder.degree(), b.degree()) << a_size << " / " << b_size;
+        ASSERT_EQ(quotient * b + remainder, a) << a_size << " / " << b_size;
+    }
+
+    auto a = random_polynomial(500);
+    auto b = random_polynomial(300);
+    EXPECT_EQ((a * b) / b, a);
+    EXPECT_TRUE(((a * b) % b).is_zero());
+    EXPECT_THROW(a.divide(Polynomial()), PolynomialError);
+}
+
+TEST_F(PolynomialTest, MultipointEvaluation) {
+    for (size_t num_points : {0u, 10u, 1023u, 1024u, 1500u}) {
+        auto p = random_polynomial(700);
+        auto points = rng.random_elements(num_points);
+        auto values = p.evaluate(points);
+        ASSERT_EQ(values.size(), num_points);
+        for (size_t i = 0; i < num_points; i++) {
+            ASSERT_EQ(values[i], p.evaluate(points[i])) << num_points << " points";
+        }
+    }
+}
+
+TEST_F(PolynomialTest, InterpolationInvertsEvaluation) {
+    for (size_t num_points : {1u, 2u, 50u, 128u, 600u}) {
+        auto p = random_polynomial(num_points);
+        auto points = rng.random_elements(num_points);
+        EXPECT_EQ(Polynomial::interpolate(points, p.evaluate(points)), p) << num_points << " points";
+    }
+    EXPECT_TRUE(Polynomial::interpolate({}, {}).is_zero());
+}
+
+TEST_F(PolynomialTest, ZerofierVanishesOnRoots) {
+    for (size_t num_roots : {3u, 300u}) {
+        auto roots = rng.random_elements(num_roots);
+        auto zerofier = Polynomial::zerofier(roots);
+        EXPECT_EQ(zerofier.degree(), static_cast<int64_t>(num_roots));
+        EXPECT_EQ(zerofier.leading_coefficient(), BFieldElement::one());
+        for (const auto& value : zerofier.evaluate(roots)) {
+            ASSERT_TRUE(value.is_zero());
+        }
+    }
+}
+
+TEST_F(PolynomialTest, InterpolationRejectsBadInput) {
+    auto points = rng.random_elements(200);
+    auto values = rng.random_elements(200);
+    EXPECT_THROW(Polynomial::interpolate(points, std::vector<BFieldElement>(199)), PolynomialError);
+
+    points[150] = points[20];
+    EXPECT_THROW(Polynomial::interpolate(points, values), PolynomialError);
+    points.resize(10);
+    values.resize(10);
+    points[9] = points[0];
+    EXPECT_THROW(Polynomial::interpolate(points, values), PolynomialError);
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <gtest/gtest.h>
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/sharded_merkle_tree.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class ShardedMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+    std::filesystem::path dir;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() /
+              ("tip5xx_sharded_" + std::to_string(rng.random_range<uint64_t>(1, UINT64_MAX)));
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+
+    std::string write_leaves(const std::vector<Digest>& leaves) {
+        auto path = (dir / "leaves.bin").string();
+        std::ofstream out(path, std::ios::binary);
+        for (const auto& leaf : leaves) {
+            auto bytes = leaf.to_bytes();
+            out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        }
+        return path;
+    }
+
+    void expect_matches(const ShardedMerkleTree& sharded, const std::vector<Digest>& leaves) {
+        auto expected = MerkleTree::build(leaves);
+        EXPECT_EQ(sharded.root(), expected.root());
+        EXPECT_EQ(sharded.num_leaves(), leaves.size());
+        EXPECT_EQ(sharded.height(), expected.height());
+        for (size_t i = 0; i < leaves.size(); i++) {
+            ASSERT_EQ(sharded.leaf(i), leaves[i]);
+            ASSERT_EQ(sharded.authentication_path(i), expected.authentication_path(i));
+        }
+    }
+};
+
+TEST_F(ShardedMerkleTreeTest, MatchesInMemoryTree) {
+    auto leaves = rng.random_digests(256);
+    auto leaves_path = write_leaves(leaves);
+    for (uint64_t num_shards : {1, 2, 8, 256}) {
+        std::vector<std::thread> workers;
+        for (uint64_t k = 0; k < num_shards; k++) {
+            workers.emplace_back([&, k]() {
+                ShardedMerkleTree::build_shard(leaves_path, k, num_shards, dir.string());
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        EXPECT_EQ(ShardedMerkleTree::merge(dir.string(), num_shards), MerkleTree::build(leaves).root());
+        auto sharded = ShardedMerkleTree::open(dir.string());
+        EXPECT_EQ(sharded.num_shards(), num_shards);
+        expect_matches(sharded, leaves);
+    }
+}
+
+#ifndef _WIN32
+TEST_F(ShardedMerkleTreeTest, WorkersInSeparateProcesses) {
+    auto leaves = rng.random_digests(1024);
+    auto leaves_path = write_leaves(leaves);
+    const uint64_t num_shards = 4;
+
+    std::vector<pid_t> children;
+    for (uint64_t k = 0; k < num_shards; k++) {
+        pid_t pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            ThreadPool pool(1);
+            ShardedMerkleTree::build_shard(leaves_path, k, num_shards, dir.string(), pool);
+            _exit(0);
+        }
+        children.push_back(pid);
+    }
+    for (pid_t pid : children) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+
+    ShardedMerkleTree::merge(dir.string(), num_shards);
+    expect_matches(ShardedMerkleTree::open(dir.string()), leaves);
+}
+#endif
+
+TEST_F(ShardedMerkleTreeTest, RejectsBadShardsAndSummaries) {
+    auto leaves_path = write_leaves(rng.random_digests(16));
+    EXPECT_THROW(ShardedMerkleTree::build_shard(leaves_path, 0, 3, dir.string()), MerkleTreeError);
+    EXPECT_THROW(ShardedMerkleTree::build_shard(leaves_path, 4, 4, dir.string()), MerkleTreeError);
+    EXPECT_THROW(ShardedMerkleTree::build_shard(leaves_path, 0, 32, dir.string()), MerkleTreeError);
+    try {
+        ShardedMerkleTree::build_shard(leaves_path, 4, 4, dir.string());
+        FAIL() << "Expected MerkleTreeError";
+    } catch (const MerkleTreeError& e) {
+        EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidArgument);
+    }
+    try {
+        ShardedMerkleTree::merge(dir.string(), 3);
+        FAIL() << "Expected MerkleTreeError";
+    } catch (const MerkleTreeError& e) {
+        EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidArgument);
+    }
+
+    // Shard 1 is missing
+    ShardedMerkleTree::build_shard(leaves_path, 0, 2, dir.string());
+    EXPECT_THROW(ShardedMerkleTree::merge(dir.string(), 2), MerkleTreeError);
+
+    // Shard 1 comes from a split into four
+    ShardedMerkleTree::build_shard(leaves_path, 1, 4, dir.string());
+    EXPECT_THROW(ShardedMerkleTree::merge(dir.string(), 2), MerkleTreeError);
+
+    ShardedMerkleTree::build_shard(leaves_path, 1, 2, dir.string());
+    EXPECT_NO_THROW(ShardedMerkleTree::merge(dir.string(), 2));
+
+    // A shard tree rebuilt over other leaves no longer matches the top tree
+    auto other_leaves_path = write_leaves(rng.random_digests(16));
+    ShardedMerkleTree::build_shard(other_leaves_path, 1, 2, dir.string());
+    EXPECT_THROW(ShardedMerkleTree::open(dir.string()), MerkleTreeError);
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "tip5xx/merkle_tree_error.hpp"
+#include "tip5xx/sparse_merkle_tree.hpp"
+#include "tip5xx/tip5xx.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class SparseMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(SparseMerkleTreeTest, EmptyTreeHasDefaultRoot) {
+    SparseMerkleTree tree;
+    const auto& defaults = SparseMerkleTree::default_digests();
+    EXPECT_EQ(defaults[0], Digest());
+    EXPECT_EQ(defaults[1], Tip5::hash_pair(Digest(), Digest()));
+    EXPECT_EQ(tree.root(), defaults[SparseMerkleTree::DEPTH]);
+    EXPECT_EQ(tree.num_stored_nodes(), 0u);
+}
+
+TEST_F(SparseMerkleTreeTest, SingleEntryRootMatchesManualPath) {
+    SparseMerkleTree tree;
+    auto key = rng.random_digest();
+    auto value = rng.random_digest();
+    tree.insert(key, value);
+
+    const auto& defaults = SparseMerkleTree::default_digests();
+    uint64_t index = SparseMerkleTree::slot(key);
+    Digest acc = SparseMerkleTree::leaf_digest(key, value);
+    for (size_t level = 0; level < SparseMerkleTree::DEPTH; level++, index >>= 1) {
+        acc = (index & 1) ? Tip5::hash_pair(defaults[level], acc) : Tip5::hash_pair(acc, defaults[level]);
+    }
+    EXPECT_EQ(tree.root(), acc);
+    EXPECT_EQ(tree.get(key), value);
+    EXPECT_EQ(tree.num_stored_nodes(), SparseMerkleTree::DEPTH + 1);
+}
+
+TEST_F(SparseMerkleTreeTest, BatchedAndSingleUpdatesAgree) {
+    std::vector<std::pair<Digest, std::optional<Digest>>> updates;
+    for (size_t i = 0; i < 200; i++) {
+        updates.emplace_back(rng.random_digest(), rng.random_digest());
+    }
+    // Neighbouring slots share almost their whole path
+    auto neighbour = updates[0].first;
+    neighbour[0] = BFieldElement::new_element(neighbour[0].value() ^ 1);
+    updates.emplace_back(neighbour, rng.random_digest());
+
+    SparseMerkleTree batched;
+    batched.update(updates);
+
+    SparseMerkleTree single;
+    std::reverse(updates.begin(), updates.end());
+    for (const auto& [key, value] : updates) {
+        single.insert(key, *value);
+    }
+
+    EXPECT_EQ(batched.root(), single.root());
+    EXPECT_EQ(batched.size(), updates.size());
+    EXPECT_EQ(batched.num_stored_nodes(), single.num_stored_nodes());
+}
+
+TEST_F(SparseMerkleTreeTest, RemovingEverythingRestoresDefaultRoot) {
+    SparseMerkleTree tree;
+    auto keys = rng.random_digests(50);
+    for (const auto& key : keys) {
+        tree.insert(key, rng.random_digest());
+    }
+
+    // Removing an absent key changes nothing
+    auto root = tree.root();
+    tree.remove(rng.random_digest());
+    EXPECT_EQ(tree.root(), root);
+
+    std::vector<std::pair<Digest, std::optional<Digest>>> removals;
+    for (const auto& key : keys) {
+        removals.emplace_back(key, std::nullopt);
+    }
+    tree.update(removals);
+    EXPECT_EQ(tree.root(), SparseMerkleTree::default_digests()[SparseMerkleTree::DEPTH]);
+    EXPECT_EQ(tree.num_stored_nodes(), 0u);
+    EXPECT_FALSE(tree.get(keys[0]).has_value());
+}
+
+TEST_F(SparseMerkleTreeTest, MembershipAndNonMembershipProofs) {
+    SparseMerkleTree tree;
+    auto keys = rng.random_digests(30);
+    auto values = rng.random_digests(30);
+    for (size_t i = 0; i < keys.size(); i++) {
+        tree.insert(keys[i], values[i]);
+    }
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        auto proof = tree.prove(keys[i]);
+        EXPECT_LT(proof.siblings.size(), 20u);
+        EXPECT_TRUE(proof.verify(tree.root(), keys[i], values[i]));
+        EXPECT_FALSE(proof.verify(tree.root(), keys[i], values[(i + 1) % values.size()]));
+        EXPECT_FALSE(proof.verify(tree.root(), keys[i], std::nullopt));
+    }
+
+    auto absent = rng.random_digest();
+    auto proof = tree.prove(absent);
+    EXPECT_TRUE(proof.verify(tree.root(), absent, std::nullopt));
+    EXPECT_FALSE(proof.verify(tree.root(), absent, rng.random_digest()));
+
+    proof.siblings.pop_back();
+    EXPECT_FALSE(proof.verify(tree.root(), absent, std::nullopt));
+}
+
+TEST_F(SparseMerkleTreeTest, KeysSharingASlotDoNotReplaceEachOther) {
+    SparseMerkleTree tree;
+    auto key = rng.random_digest();
+    auto other = rng.random_digest();
+    other[0] = key[0];
+    auto value = rng.random_digest();
+    tree.insert(key, value);
+    auto root = tree.root();
+
+    try {
+        tree.insert(other, rng.random_digest());
+        FAIL() << "Expected MerkleTreeError";
+    } catch (const MerkleTreeError& e) {
+        EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::SlotOccupied);
+    }
+    EXPECT_THROW(tree.update({{rng.random_digest(), value}, {other, value}}), MerkleTreeError);
+    EXPECT_EQ(tree.root(), root);
+    EXPECT_EQ(tree.size(), 1u);
+    EXPECT_EQ(tree.get(key), value);
+    EXPECT_FALSE(tree.get(other).has_value());
+
+    // Removing a key that does not hold the slot leaves it alone
+    tree.remove(other);
+    EXPECT_EQ(tree.get(key), value);
+
+    // Once the slot is freed, in the same batch, another key may take it
+    tree.update({{key, std::nullopt}, {other, value}});
+    EXPECT_EQ(tree.get(other), value);
+    EXPECT_FALSE(tree.get(key).has_value());
+    EXPECT_TRUE(tree.prove(other).verify(tree.root(), other, value));
+}
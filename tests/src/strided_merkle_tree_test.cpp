@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include "tip5xx/strided_merkle_tree.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class StridedMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(StridedMerkleTreeTest, SamePathsAsFullTree) {
+    for (size_t log_n : {0, 1, 5, 9}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        auto expected = MerkleTree::build(leaves);
+        for (size_t stride : {1, 2, 3, 4, 16}) {
+            ThreadPool pool(2);
+            auto tree = StridedMerkleTree::build(leaves, stride, pool);
+            EXPECT_EQ(tree.root(), expected.root());
+            EXPECT_EQ(tree.height(), expected.height());
+            for (size_t i = 0; i < leaves.size(); i++) {
+                ASSERT_EQ(tree.leaf(i), leaves[i]);
+                ASSERT_EQ(tree.authentication_path(i), expected.authentication_path(i)) << "stride " << stride;
+            }
+        }
+    }
+}
+
+TEST_F(StridedMerkleTreeTest, StrideTradesMemory) {
+    const size_t log_n = 12;
+    const size_t n = size_t{1} << log_n;
+    auto leaves = rng.random_digests(n);
+
+    // Stride 1 keeps every level; stride 3 keeps levels 0, 3, 6, 9 and 12
+    EXPECT_EQ(StridedMerkleTree::build(leaves, 1).num_stored_digests(), 2 * n - 1);
+    EXPECT_EQ(StridedMerkleTree::build(leaves, 3).num_stored_digests(), n + n / 8 + n / 64 + n / 512 + 1);
+    EXPECT_EQ(StridedMerkleTree::build(leaves, 20).num_stored_digests(), n + 1);
+
+    auto tree = StridedMerkleTree::build(leaves, 4);
+    EXPECT_EQ(tree.level_stride(), 4u);
+    EXPECT_THROW(tree.authentication_path(n), MerkleTreeError);
+    EXPECT_THROW(StridedMerkleTree::build(rng.random_digests(12), 2), MerkleTreeError);
+}
@@ -175,6 +175,19 @@ TEST_F(Tip5Test, TestLinearityOfMds) {
     }
 }
 
+TEST_F(Tip5Test, MdsNttMatchesGeneratedMds) {
+    for (size_t trial = 0; trial < 20; trial++) {
+        Tip5 generated(Domain::VariableLength);
+        for (auto& element : generated.state) {
+            element = rng.random_bfe();
+        }
+        Tip5 ntt = generated;
+        generated.mds_generated();
+        ntt.mds_ntt();
+        ASSERT_EQ(ntt.state, generated.state);
+    }
+}
+
 TEST_F(Tip5Test, TestMdsCirculancy) {
     Tip5 sponge(Domain::VariableLength);
     sponge.state.fill(BFieldElement::zero());
@@ -412,3 +425,48 @@ TEST_F(Tip5Test, ReturnsRequestedNumberAndCallsPermutation) {
     }
 
 }
+
+TEST_F(Tip5Test, HashPairBatchMatchesHashPair) {
+    // Cover a partial last chunk of lanes as well as whole chunks
+    for (size_t count : {0, 1, 7, 8, 9, 35}) {
+        std::vector<Digest> left, right;
+        for (size_t i = 0; i < count; i++) {
+            std::array<BFieldElement, Digest::LEN> l, r;
+            for (size_t j = 0; j < Digest::LEN; j++) {
+                l[j] = rng.random_bfe();
+                r[j] = rng.random_bfe();
+            }
+            left.emplace_back(l);
+            right.emplace_back(r);
+        }
+
+        std::vector<Digest> out(count);
+        Tip5::hash_pair_batch(left.data(), right.data(), out.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(out[i], Tip5::hash_pair(left[i], right[i])) << "count " << count << ", index " << i;
+        }
+    }
+}
+
+TEST_F(Tip5Test, DomainTaggedHashPair) {
+    auto left = rng.random_digests(11);
+    auto right = rng.random_digests(11);
+    EXPECT_EQ(Tip5::hash_pair(left[0], right[0], BFieldElement::one()), Tip5::hash_pair(left[0], right[0]));
+    EXPECT_NE(Tip5::hash_pair(left[0], right[0], BFieldElement::new_element(2)),
+              Tip5::hash_pair(left[0], right[0]));
+    EXPECT_NE(Tip5::hash_pair(left[0], right[0], BFieldElement::new_element(2)),
+              Tip5::hash_pair(left[0], right[0], BFieldElement::new_element(3)));
+
+    // Whole and partial chunks of lanes
+    for (size_t count : {3, 11}) {
+        std::vector<BFieldElement> tags;
+        for (size_t i = 0; i < count; i++) {
+            tags.push_back(BFieldElement::new_element(i + 2));
+        }
+        std::vector<Digest> out(count);
+        Tip5::hash_pair_batch(left.data(), right.data(), tags.data(), out.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(out[i], Tip5::hash_pair(left[i], right[i], tags[i])) << "count " << count << ", index " << i;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "tip5xx/veb_merkle_tree.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+class VebMerkleTreeTest : public ::testing::Test {
+protected:
+    RandomGenerator rng;
+};
+
+TEST_F(VebMerkleTreeTest, PositionsArePermutation) {
+    for (size_t num_levels = 1; num_levels <= 12; num_levels++) {
+        std::vector<size_t> positions;
+        for (size_t depth = 0; depth < num_levels; depth++) {
+            for (uint64_t i = 0; i < (uint64_t{1} << depth); i++) {
+                positions.push_back(VebMerkleTree::position(num_levels, depth, i));
+            }
+        }
+        std::sort(positions.begin(), positions.end());
+        for (size_t i = 0; i < positions.size(); i++) {
+            ASSERT_EQ(positions[i], i) << num_levels << " levels";
+        }
+    }
+}
+
+TEST_F(VebMerkleTreeTest, KnownLayoutOfFourLevels) {
+    // Top tree {1, 2, 3}, then bottom trees {4, 8, 9}, {5, 10, 11}, {6, 12, 13}, {7, 14, 15}
+    std::vector<size_t> expected_order = {1, 2, 3, 4, 8, 9, 5, 10, 11, 6, 12, 13, 7, 14, 15};
+    for (size_t pos = 0; pos < expected_order.size(); pos++) {
+        size_t node_index = expected_order[pos];
+        size_t depth = 0;
+        while ((node_index >> depth) > 1) depth++;
+        EXPECT_EQ(VebMerkleTree::position(4, depth, node_index - (size_t{1} << depth)), pos);
+    }
+}
+
+TEST_F(VebMerkleTreeTest, SameNodesAndPathsAsLevelOrderTree) {
+    for (size_t log_n : {0, 1, 5, 8}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        auto tree = MerkleTree::build(leaves);
+        VebMerkleTree veb(tree);
+
+        EXPECT_EQ(veb.root(), tree.root());
+        EXPECT_EQ(veb.height(), tree.height());
+        EXPECT_EQ(veb.num_leaves(), tree.num_leaves());
+        for (size_t node_index = 1; node_index < 2 * tree.num_leaves(); node_index++) {
+            ASSERT_EQ(veb.node(node_index), tree.node(node_index));
+        }
+        for (size_t i = 0; i < leaves.size(); i++) {
+            ASSERT_EQ(veb.leaf(i), leaves[i]);
+            ASSERT_EQ(veb.authentication_path(i), tree.authentication_path(i));
+        }
+        EXPECT_THROW(veb.leaf(leaves.size()), MerkleTreeError);
+        for (size_t node_index : {size_t{0}, 2 * leaves.size()}) {
+            try {
+                veb.node(node_index);
+                FAIL() << "Expected MerkleTreeError";
+            } catch (const MerkleTreeError& e) {
+                EXPECT_EQ(e.type(), MerkleTreeError::ErrorType::InvalidArgument);
+            }
+        }
+    }
+}
+
+TEST_F(VebMerkleTreeTest, BuildHashesStraightIntoLayout) {
+    for (size_t log_n : {0, 1, 5, 11}) {
+        auto leaves = rng.random_digests(size_t{1} << log_n);
+        auto tree = MerkleTree::build(leaves);
+        auto veb = VebMerkleTree::build(leaves);
+
+        EXPECT_EQ(veb.root(), tree.root());
+        for (size_t node_index = 1; node_index < 2 * tree.num_leaves(); node_index++) {
+            ASSERT_EQ(veb.node(node_index), tree.node(node_index));
+        }
+
+        std::vector<Digest> path(veb.height());
+        for (size_t i = 0; i < leaves.size(); i += 7) {
+            veb.authentication_path(i, path.data());
+            ASSERT_EQ(path, tree.authentication_path(i));
+        }
+    }
+    EXPECT_THROW(VebMerkleTree::build(rng.random_digests(3)), MerkleTreeError);
+}